@@ -0,0 +1,126 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_AFFINE_POINT_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_AFFINE_POINT_HPP_INCLUDED
+
+#include "type.hpp"
+
+namespace strong
+{
+
+template <typename D>
+struct affine_point
+{
+  template <typename T>
+  class modifier;
+};
+
+namespace impl
+{
+  template <typename T, typename = void>
+  struct subtractable : std::false_type {};
+
+  template <typename T>
+  struct subtractable<T, void_t<decltype(std::declval<const T&>() - std::declval<const T&>())>>
+  : std::true_type {};
+}
+
+
+template <typename D>
+template <typename T, typename Tag, typename ... M>
+class affine_point<D>::modifier<::strong::type<T, Tag, M...>>
+{
+  using type = ::strong::type<T, Tag, M...>;
+  static_assert(impl::subtractable<T>::value, "it must be possible to subtract instances of your underlying type");
+  using diff_type = decltype(std::declval<const T&>() - std::declval<const T&>());
+  static_assert(std::is_constructible<D, diff_type>::value,"");
+public:
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  D
+  operator-(
+    const type& lh,
+    const type& rh)
+  noexcept(noexcept(D(value_of(lh) - value_of(rh))))
+  {
+    return D(value_of(lh) - value_of(rh));
+  }
+
+  friend
+  STRONG_CONSTEXPR
+  type&
+  operator+=(
+    type& lh,
+    const D& d)
+  noexcept(noexcept(value_of(lh) += impl::access(d)))
+  {
+    value_of(lh) += impl::access(d);
+    return lh;
+  }
+
+  friend
+  STRONG_CONSTEXPR
+  type&
+  operator-=(
+    type& lh,
+    const D& d)
+  noexcept(noexcept(value_of(lh) -= impl::access(d)))
+  {
+    value_of(lh) -= impl::access(d);
+    return lh;
+  }
+
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  type
+  operator+(
+    type lh,
+    const D& d)
+  noexcept(noexcept(lh += d) && std::is_nothrow_move_constructible<type>::value)
+  {
+    lh += d;
+    return lh;
+  }
+
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  type
+  operator+(
+    const D& d,
+    type rh)
+  noexcept(noexcept(rh += d) && std::is_nothrow_move_constructible<type>::value)
+  {
+    rh += d;
+    return rh;
+  }
+
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  type
+  operator-(
+    type lh,
+    const D& d)
+  noexcept(noexcept(lh -= d) && std::is_nothrow_move_constructible<type>::value)
+  {
+    lh -= d;
+    return lh;
+  }
+};
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_AFFINE_POINT_HPP_INCLUDED
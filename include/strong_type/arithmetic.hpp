@@ -0,0 +1,428 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_ARITHMETIC_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_ARITHMETIC_HPP_INCLUDED
+
+#include "type.hpp"
+
+namespace strong
+{
+
+struct arithmetic
+{
+  template <typename T>
+  class modifier
+  {
+  public:
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator-(
+      const T &lh)
+    noexcept(noexcept(T{-value_of(lh)}))
+    {
+      return T{-value_of(lh)};
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator+=(
+      T &lh,
+      const T &rh)
+    noexcept(noexcept(value_of(lh) += value_of(rh)))
+    {
+      value_of(lh) += value_of(rh);
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator-=(
+      T &lh,
+      const T &rh)
+    noexcept(noexcept(value_of(lh) -= value_of(rh)))
+    {
+      value_of(lh) -= value_of(rh);
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator*=(
+      T &lh,
+      const T &rh)
+    noexcept(noexcept(value_of(lh) *= value_of(rh)))
+    {
+      value_of(lh) *= value_of(rh);
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator/=(
+      T &lh,
+      const T &rh)
+    noexcept(noexcept(value_of(lh) /= value_of(rh)))
+    {
+      value_of(lh) /= value_of(rh);
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator+(
+      T lh,
+      const T &rh)
+    noexcept(noexcept(lh += rh) && std::is_nothrow_move_constructible<T>::value)
+    {
+      lh += rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator-(
+      T lh,
+      const T &rh)
+    noexcept(noexcept(lh -= rh) && std::is_nothrow_move_constructible<T>::value)
+    {
+      lh -= rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator*(
+      T lh,
+      const T &rh)
+    noexcept(noexcept(lh *= rh) && std::is_nothrow_move_constructible<T>::value)
+    {
+      lh *= rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator/(
+      T lh,
+      const T &rh)
+    noexcept(noexcept(lh /= rh) && std::is_nothrow_move_constructible<T>::value)
+    {
+      lh /= rh;
+      return lh;
+    }
+  };
+};
+
+// Operations for strong::arithmetic_with<>. The strong type is the left
+// operand, and Other the right, or either for plus and times. Result is the
+// type of the result, or when void, the strong type itself, which also
+// gives the compound assignment.
+template <typename Other, typename Result = void>
+struct plus {};
+
+template <typename Other, typename Result = void>
+struct minus {};
+
+template <typename Other, typename Result = void>
+struct times {};
+
+template <typename Other, typename Result = void>
+struct divided_by {};
+
+namespace impl
+{
+  template <typename T, typename Other, typename R>
+  class typed_plus
+  {
+    using TT = underlying_type_t<T>;
+    using OT = underlying_type_t<Other>;
+  public:
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    R
+    operator+(
+      const T& lh,
+      const Other& rh)
+    noexcept(noexcept(R(std::declval<const TT&>() + std::declval<const OT&>())))
+    {
+      return R(value_of(lh) + impl::access(rh));
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    R
+    operator+(
+      const Other& lh,
+      const T& rh)
+    noexcept(noexcept(R(std::declval<const OT&>() + std::declval<const TT&>())))
+    {
+      return R(impl::access(lh) + value_of(rh));
+    }
+  };
+
+  template <typename T, typename Other, typename R>
+  class typed_minus
+  {
+    using TT = underlying_type_t<T>;
+    using OT = underlying_type_t<Other>;
+  public:
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    R
+    operator-(
+      const T& lh,
+      const Other& rh)
+    noexcept(noexcept(R(std::declval<const TT&>() - std::declval<const OT&>())))
+    {
+      return R(value_of(lh) - impl::access(rh));
+    }
+  };
+
+  template <typename T, typename Other, typename R>
+  class typed_times
+  {
+    using TT = underlying_type_t<T>;
+    using OT = underlying_type_t<Other>;
+  public:
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    R
+    operator*(
+      const T& lh,
+      const Other& rh)
+    noexcept(noexcept(R(std::declval<const TT&>() * std::declval<const OT&>())))
+    {
+      return R(value_of(lh) * impl::access(rh));
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    R
+    operator*(
+      const Other& lh,
+      const T& rh)
+    noexcept(noexcept(R(std::declval<const OT&>() * std::declval<const TT&>())))
+    {
+      return R(impl::access(lh) * value_of(rh));
+    }
+  };
+
+  template <typename T, typename Other, typename R>
+  class typed_divided_by
+  {
+    using TT = underlying_type_t<T>;
+    using OT = underlying_type_t<Other>;
+  public:
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    R
+    operator/(
+      const T& lh,
+      const Other& rh)
+    noexcept(noexcept(R(std::declval<const TT&>() / std::declval<const OT&>())))
+    {
+      return R(value_of(lh) / impl::access(rh));
+    }
+  };
+
+  template <typename T, typename Other>
+  class typed_plus_assign
+  {
+    using TT = underlying_type_t<T>;
+    using OT = underlying_type_t<Other>;
+  public:
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator+=(
+      T& lh,
+      const Other& rh)
+    noexcept(noexcept(std::declval<TT&>() += std::declval<const OT&>()))
+    {
+      value_of(lh) += impl::access(rh);
+      return lh;
+    }
+  };
+
+  template <typename T, typename Other>
+  class typed_minus_assign
+  {
+    using TT = underlying_type_t<T>;
+    using OT = underlying_type_t<Other>;
+  public:
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator-=(
+      T& lh,
+      const Other& rh)
+    noexcept(noexcept(std::declval<TT&>() -= std::declval<const OT&>()))
+    {
+      value_of(lh) -= impl::access(rh);
+      return lh;
+    }
+  };
+
+  template <typename T, typename Other>
+  class typed_times_assign
+  {
+    using TT = underlying_type_t<T>;
+    using OT = underlying_type_t<Other>;
+  public:
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator*=(
+      T& lh,
+      const Other& rh)
+    noexcept(noexcept(std::declval<TT&>() *= std::declval<const OT&>()))
+    {
+      value_of(lh) *= impl::access(rh);
+      return lh;
+    }
+  };
+
+  template <typename T, typename Other>
+  class typed_divided_by_assign
+  {
+    using TT = underlying_type_t<T>;
+    using OT = underlying_type_t<Other>;
+  public:
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator/=(
+      T& lh,
+      const Other& rh)
+    noexcept(noexcept(std::declval<TT&>() /= std::declval<const OT&>()))
+    {
+      value_of(lh) /= impl::access(rh);
+      return lh;
+    }
+  };
+
+  template <typename T, typename Op>
+  class typed_arithmetic
+    : public typed_arithmetic<T, plus<Op>>
+    , public typed_arithmetic<T, minus<Op>>
+    , public typed_arithmetic<T, times<Op>>
+    , public typed_arithmetic<T, divided_by<Op>>
+  {
+  };
+
+  template <typename T, typename Other, typename R>
+  class typed_arithmetic<T, plus<Other, R>>
+    : public typed_plus<T, Other, R>
+  {
+  };
+
+  template <typename T, typename Other>
+  class typed_arithmetic<T, plus<Other, void>>
+    : public typed_plus<T, Other, T>
+    , public typed_plus_assign<T, Other>
+  {
+  };
+
+  template <typename T, typename Other, typename R>
+  class typed_arithmetic<T, minus<Other, R>>
+    : public typed_minus<T, Other, R>
+  {
+  };
+
+  template <typename T, typename Other>
+  class typed_arithmetic<T, minus<Other, void>>
+    : public typed_minus<T, Other, T>
+    , public typed_minus_assign<T, Other>
+  {
+  };
+
+  template <typename T, typename Other, typename R>
+  class typed_arithmetic<T, times<Other, R>>
+    : public typed_times<T, Other, R>
+  {
+  };
+
+  template <typename T, typename Other>
+  class typed_arithmetic<T, times<Other, void>>
+    : public typed_times<T, Other, T>
+    , public typed_times_assign<T, Other>
+  {
+  };
+
+  template <typename T, typename Other, typename R>
+  class typed_arithmetic<T, divided_by<Other, R>>
+    : public typed_divided_by<T, Other, R>
+  {
+  };
+
+  template <typename T, typename Other>
+  class typed_arithmetic<T, divided_by<Other, void>>
+    : public typed_divided_by<T, Other, T>
+    , public typed_divided_by_assign<T, Other>
+  {
+  };
+
+}
+
+// Arithmetic between the strong type and other types. Each of Ts is either
+// strong::plus<Other, Result>, strong::minus<Other, Result>,
+// strong::times<Other, Result> or strong::divided_by<Other, Result>, or a
+// type Other, which is short for all four with the strong type as the
+// result. Note! While Ts can include other strong types, it can not refer to
+// the strong type being defined. Use strong::arithmetic for that.
+template <typename ... Ts>
+struct arithmetic_with
+{
+  template <typename T>
+  class modifier : public impl::typed_arithmetic<T, Ts>...
+  {
+  };
+};
+
+#if STRONG_HAS_CONCEPTS
+template <typename T>
+concept arithmetic_type = type_with<T, arithmetic>;
+#endif
+
+}
+
+namespace std {
+template <typename T, typename Tag, typename ... M>
+struct is_arithmetic<::strong::type<T, Tag, M...>>
+  : is_base_of<::strong::arithmetic::modifier<::strong::type<T, Tag, M...>>,
+               ::strong::type<T, Tag, M...>>
+{
+};
+}
+#endif //ROLLBEAR_STRONG_TYPE_ARITHMETIC_HPP_INCLUDED
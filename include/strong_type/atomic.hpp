@@ -0,0 +1,436 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_ATOMIC_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_ATOMIC_HPP_INCLUDED
+
+#include "arithmetic.hpp"
+#include "bitarithmetic.hpp"
+#include "difference.hpp"
+#include "incrementable.hpp"
+#include "ordered.hpp"
+
+#include <atomic>
+
+namespace strong
+{
+
+// The read-modify-write operations are constrained by requires-clauses with
+// concepts, and by std::enable_if on a defaulted template parameter without.
+#if STRONG_HAS_CONCEPTS
+#define STRONG_ATOMIC_TEMPLATE(when)
+#define STRONG_ATOMIC_REQUIRES(concept_) requires concept_<S>
+#else
+#define STRONG_ATOMIC_TEMPLATE(when) template <typename SS = S, typename = impl::when<SS>>
+#define STRONG_ATOMIC_REQUIRES(concept_)
+#endif
+
+namespace impl
+{
+#if STRONG_HAS_CONCEPTS
+  template <typename S>
+  concept fetch_addable = arithmetic_type<S> || type_with<S, difference>;
+#else
+  template <typename S>
+  using WhenFetchAddable = std::enable_if_t<type_is<S, arithmetic>::value ||
+                                            type_is<S, difference>::value>;
+  template <typename S>
+  using WhenBitArithmetic = std::enable_if_t<type_is<S, bitarithmetic>::value>;
+  template <typename S>
+  using WhenOrdered = std::enable_if_t<type_is<S, ordered>::value>;
+  template <typename S>
+  using WhenIncrementable = std::enable_if_t<type_is<S, incrementable>::value>;
+  template <typename S>
+  using WhenDecrementable = std::enable_if_t<type_is<S, decrementable>::value>;
+#endif
+
+  // The strongest order a load may have, for the load part of a
+  // read-modify-write loop with the order o.
+  constexpr std::memory_order load_order(std::memory_order o) noexcept
+  {
+    return o == std::memory_order_release ? std::memory_order_relaxed
+         : o == std::memory_order_acq_rel ? std::memory_order_acquire
+         : o;
+  }
+
+  // The operations of strong::atomic<S> and strong::atomic_ref<S>, on A,
+  // which is std::atomic<T> or std::atomic_ref<T> for the underlying type T.
+  // Only the read-modify-write operations that the modifiers of S allow are
+  // available.
+  template <typename S, typename A>
+  class atomic_operations
+  {
+  protected:
+    using T = underlying_type_t<S>;
+
+    template <typename ... U>
+    constexpr explicit atomic_operations(U&& ... u) noexcept
+      : a_(std::forward<U>(u)...)
+    {
+    }
+  public:
+    using value_type = S;
+
+    STRONG_NODISCARD
+    bool
+    is_lock_free()
+    const
+    noexcept
+    {
+      return a_.is_lock_free();
+    }
+
+    STRONG_NODISCARD
+    S
+    load(
+      std::memory_order o = std::memory_order_seq_cst)
+    const
+    noexcept
+    {
+      return S{a_.load(o)};
+    }
+
+    void
+    store(
+      const S& s,
+      std::memory_order o = std::memory_order_seq_cst)
+    noexcept
+    {
+      a_.store(value_of(s), o);
+    }
+
+    operator S() const noexcept { return load(); }
+
+    S
+    exchange(
+      const S& s,
+      std::memory_order o = std::memory_order_seq_cst)
+    noexcept
+    {
+      return S{a_.exchange(value_of(s), o)};
+    }
+
+    bool
+    compare_exchange_weak(
+      S& expected,
+      const S& desired,
+      std::memory_order success,
+      std::memory_order failure)
+    noexcept
+    {
+      return a_.compare_exchange_weak(value_of(expected), value_of(desired), success, failure);
+    }
+
+    bool
+    compare_exchange_weak(
+      S& expected,
+      const S& desired,
+      std::memory_order o = std::memory_order_seq_cst)
+    noexcept
+    {
+      return a_.compare_exchange_weak(value_of(expected), value_of(desired), o);
+    }
+
+    bool
+    compare_exchange_strong(
+      S& expected,
+      const S& desired,
+      std::memory_order success,
+      std::memory_order failure)
+    noexcept
+    {
+      return a_.compare_exchange_strong(value_of(expected), value_of(desired), success, failure);
+    }
+
+    bool
+    compare_exchange_strong(
+      S& expected,
+      const S& desired,
+      std::memory_order o = std::memory_order_seq_cst)
+    noexcept
+    {
+      return a_.compare_exchange_strong(value_of(expected), value_of(desired), o);
+    }
+
+    STRONG_ATOMIC_TEMPLATE(WhenFetchAddable)
+    S
+    fetch_add(
+      const S& s,
+      std::memory_order o = std::memory_order_seq_cst)
+    noexcept
+    STRONG_ATOMIC_REQUIRES(impl::fetch_addable)
+    {
+      return S{a_.fetch_add(value_of(s), o)};
+    }
+
+    STRONG_ATOMIC_TEMPLATE(WhenFetchAddable)
+    S
+    fetch_sub(
+      const S& s,
+      std::memory_order o = std::memory_order_seq_cst)
+    noexcept
+    STRONG_ATOMIC_REQUIRES(impl::fetch_addable)
+    {
+      return S{a_.fetch_sub(value_of(s), o)};
+    }
+
+    STRONG_ATOMIC_TEMPLATE(WhenBitArithmetic)
+    S
+    fetch_and(
+      const S& s,
+      std::memory_order o = std::memory_order_seq_cst)
+    noexcept
+    STRONG_ATOMIC_REQUIRES(bitarithmetic_type)
+    {
+      return S{a_.fetch_and(value_of(s), o)};
+    }
+
+    STRONG_ATOMIC_TEMPLATE(WhenBitArithmetic)
+    S
+    fetch_or(
+      const S& s,
+      std::memory_order o = std::memory_order_seq_cst)
+    noexcept
+    STRONG_ATOMIC_REQUIRES(bitarithmetic_type)
+    {
+      return S{a_.fetch_or(value_of(s), o)};
+    }
+
+    STRONG_ATOMIC_TEMPLATE(WhenBitArithmetic)
+    S
+    fetch_xor(
+      const S& s,
+      std::memory_order o = std::memory_order_seq_cst)
+    noexcept
+    STRONG_ATOMIC_REQUIRES(bitarithmetic_type)
+    {
+      return S{a_.fetch_xor(value_of(s), o)};
+    }
+
+    STRONG_ATOMIC_TEMPLATE(WhenOrdered)
+    S
+    fetch_max(
+      const S& s,
+      std::memory_order o = std::memory_order_seq_cst)
+    noexcept
+    STRONG_ATOMIC_REQUIRES(ordered_type)
+    {
+      T current = a_.load(load_order(o));
+      while (current < value_of(s)
+             && !a_.compare_exchange_weak(current, value_of(s), o, load_order(o)))
+      {
+      }
+      return S{current};
+    }
+
+    STRONG_ATOMIC_TEMPLATE(WhenOrdered)
+    S
+    fetch_min(
+      const S& s,
+      std::memory_order o = std::memory_order_seq_cst)
+    noexcept
+    STRONG_ATOMIC_REQUIRES(ordered_type)
+    {
+      T current = a_.load(load_order(o));
+      while (value_of(s) < current
+             && !a_.compare_exchange_weak(current, value_of(s), o, load_order(o)))
+      {
+      }
+      return S{current};
+    }
+
+    STRONG_ATOMIC_TEMPLATE(WhenIncrementable)
+    S
+    operator++()
+    noexcept
+    STRONG_ATOMIC_REQUIRES(incrementable_type)
+    {
+      return S{static_cast<T>(a_.fetch_add(1) + 1)};
+    }
+
+    STRONG_ATOMIC_TEMPLATE(WhenIncrementable)
+    S
+    operator++(int)
+    noexcept
+    STRONG_ATOMIC_REQUIRES(incrementable_type)
+    {
+      return S{a_.fetch_add(1)};
+    }
+
+    STRONG_ATOMIC_TEMPLATE(WhenDecrementable)
+    S
+    operator--()
+    noexcept
+    STRONG_ATOMIC_REQUIRES(decrementable_type)
+    {
+      return S{static_cast<T>(a_.fetch_sub(1) - 1)};
+    }
+
+    STRONG_ATOMIC_TEMPLATE(WhenDecrementable)
+    S
+    operator--(int)
+    noexcept
+    STRONG_ATOMIC_REQUIRES(decrementable_type)
+    {
+      return S{a_.fetch_sub(1)};
+    }
+  protected:
+    A a_;
+  };
+}
+
+// An atomic strong value, with the same size and lock freedom as
+// std::atomic of the underlying type.
+template <typename S>
+class atomic
+  : public impl::atomic_operations<S, std::atomic<underlying_type_t<S>>>
+{
+  using base = impl::atomic_operations<S, std::atomic<underlying_type_t<S>>>;
+  static_assert(is_strong_type<S>::value, "strong::atomic<S> requires a strong type");
+public:
+#if __cplusplus >= 201703L
+  static constexpr bool is_always_lock_free = std::atomic<underlying_type_t<S>>::is_always_lock_free;
+#endif
+
+  atomic() noexcept = default;
+
+  constexpr
+  atomic(
+    const S& s)
+  noexcept
+  : base(value_of(s))
+  {
+  }
+
+  atomic(const atomic&) = delete;
+  atomic& operator=(const atomic&) = delete;
+
+  S
+  operator=(
+    const S& s)
+  noexcept
+  {
+    this->store(s);
+    return s;
+  }
+};
+
+#if defined(__cpp_lib_atomic_ref)
+// Atomic operations on a strong value that is not itself atomic, for example
+// an element of an array.
+template <typename S>
+class atomic_ref
+  : public impl::atomic_operations<S, std::atomic_ref<underlying_type_t<S>>>
+{
+  using base = impl::atomic_operations<S, std::atomic_ref<underlying_type_t<S>>>;
+  static_assert(is_strong_type<S>::value, "strong::atomic_ref<S> requires a strong type");
+public:
+  static constexpr bool is_always_lock_free = std::atomic_ref<underlying_type_t<S>>::is_always_lock_free;
+  static constexpr std::size_t required_alignment = std::atomic_ref<underlying_type_t<S>>::required_alignment;
+
+  explicit
+  atomic_ref(
+    S& s)
+  noexcept
+  : base(value_of(s))
+  {
+  }
+
+  atomic_ref(const atomic_ref&) noexcept = default;
+  atomic_ref& operator=(const atomic_ref&) = delete;
+
+  S
+  operator=(
+    const S& s)
+  const
+  noexcept
+  {
+    this->a_.store(value_of(s));
+    return s;
+  }
+
+  // As for std::atomic_ref, the referenced value is not part of the state of
+  // the reference, so these are available on a const atomic_ref.
+  void
+  store(
+    const S& s,
+    std::memory_order o = std::memory_order_seq_cst)
+  const
+  noexcept
+  {
+    this->a_.store(value_of(s), o);
+  }
+
+  S
+  exchange(
+    const S& s,
+    std::memory_order o = std::memory_order_seq_cst)
+  const
+  noexcept
+  {
+    return S{this->a_.exchange(value_of(s), o)};
+  }
+
+  bool
+  compare_exchange_weak(
+    S& expected,
+    const S& desired,
+    std::memory_order success,
+    std::memory_order failure)
+  const
+  noexcept
+  {
+    return this->a_.compare_exchange_weak(value_of(expected), value_of(desired), success, failure);
+  }
+
+  bool
+  compare_exchange_weak(
+    S& expected,
+    const S& desired,
+    std::memory_order o = std::memory_order_seq_cst)
+  const
+  noexcept
+  {
+    return this->a_.compare_exchange_weak(value_of(expected), value_of(desired), o);
+  }
+
+  bool
+  compare_exchange_strong(
+    S& expected,
+    const S& desired,
+    std::memory_order success,
+    std::memory_order failure)
+  const
+  noexcept
+  {
+    return this->a_.compare_exchange_strong(value_of(expected), value_of(desired), success, failure);
+  }
+
+  bool
+  compare_exchange_strong(
+    S& expected,
+    const S& desired,
+    std::memory_order o = std::memory_order_seq_cst)
+  const
+  noexcept
+  {
+    return this->a_.compare_exchange_strong(value_of(expected), value_of(desired), o);
+  }
+};
+#endif
+
+#undef STRONG_ATOMIC_TEMPLATE
+#undef STRONG_ATOMIC_REQUIRES
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_ATOMIC_HPP_INCLUDED
@@ -0,0 +1,180 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_BITARITHMETIC_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_BITARITHMETIC_HPP_INCLUDED
+
+#include "type.hpp"
+
+namespace strong
+{
+
+struct bitarithmetic
+{
+  template <typename T>
+  class modifier
+  {
+  public:
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator&=(
+      T &lh,
+      const T &rh)
+    noexcept(noexcept(value_of(lh) &= value_of(rh)))
+    {
+      value_of(lh) &= value_of(rh);
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator|=(
+      T &lh,
+      const T &rh)
+    noexcept(noexcept(value_of(lh) |= value_of(rh)))
+    {
+      value_of(lh) |= value_of(rh);
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator^=(
+      T &lh,
+      const T &rh)
+    noexcept(noexcept(value_of(lh) ^= value_of(rh)))
+    {
+      value_of(lh) ^= value_of(rh);
+      return lh;
+    }
+
+    template <typename C>
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator<<=(
+      T &lh,
+      C c)
+    noexcept(noexcept(value_of(lh) <<= c))
+    {
+      value_of(lh) <<= c;
+      return lh;
+    }
+
+    template <typename C>
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator>>=(
+      T &lh,
+      C c)
+    noexcept(noexcept(value_of(lh) >>= c))
+    {
+      value_of(lh) >>= c;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator~(
+      const T &lh)
+    noexcept(std::is_nothrow_copy_constructible<underlying_type_t<T>>::value &&
+             noexcept(std::declval<underlying_type_t<T>&>() = ~std::declval<underlying_type_t<T>&>()) &&
+             std::is_nothrow_constructible<T, underlying_type_t<T>&>::value)
+    {
+      auto v = value_of(lh);
+      v = ~v;
+      return T(v);
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator&(
+      T lh,
+      const T &rh)
+    noexcept(noexcept(lh &= rh) && std::is_nothrow_move_constructible<T>::value)
+    {
+      lh &= rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator|(
+      T lh,
+      const T &rh)
+    noexcept(noexcept(lh |= rh) && std::is_nothrow_move_constructible<T>::value)
+    {
+      lh |= rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator^(
+      T lh,
+      const T &rh)
+    noexcept(noexcept(lh ^= rh) && std::is_nothrow_move_constructible<T>::value)
+    {
+      lh ^= rh;
+      return lh;
+    }
+
+    template <typename C>
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator<<(
+      T lh,
+      C c)
+    noexcept(noexcept(lh <<= c) && std::is_nothrow_move_constructible<T>::value)
+    {
+      lh <<= c;
+      return lh;
+    }
+
+    template <typename C>
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator>>(
+      T lh,
+      C c)
+    noexcept(noexcept(lh >>= c) && std::is_nothrow_move_constructible<T>::value)
+    {
+      lh >>= c;
+      return lh;
+    }
+  };
+};
+
+#if STRONG_HAS_CONCEPTS
+template <typename T>
+concept bitarithmetic_type = type_with<T, bitarithmetic>;
+#endif
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_BITARITHMETIC_HPP_INCLUDED
@@ -0,0 +1,288 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_BOUNDED_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_BOUNDED_HPP_INCLUDED
+
+#include "type.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace strong
+{
+
+// Integral values in the closed interval [Lo, Hi]. The invariant is checked
+// when a value is constructed, in checked builds, and assumed otherwise.
+// Modifiers that change the value in place, like strong::incrementable, are
+// rejected, and a value assigned through value_of() must be in the interval.
+// Sums, differences and products of bounded values of the same tag are
+// bounded types with the interval of the result, computed at compile time,
+// and convert implicitly to every bounded type of the tag with an interval
+// that contains it. strong::bounded_cast<> converts to narrower intervals.
+// Use it instead of strong::arithmetic.
+struct arithmetic;
+struct bitarithmetic;
+struct incrementable;
+struct decrementable;
+struct istreamable;
+struct parsable;
+struct serial_number;
+struct saturating_arithmetic;
+template <typename Policy>
+struct checked_arithmetic;
+template <typename D>
+struct affine_point;
+template <typename ... Ts>
+struct arithmetic_with;
+
+namespace impl
+{
+  struct difference_operators;
+}
+
+template <std::intmax_t Lo, std::intmax_t Hi>
+struct bounded
+{
+  static_assert(Lo <= Hi, "strong::bounded<Lo, Hi> requires Lo <= Hi");
+
+  template <typename T>
+  class modifier;
+};
+
+namespace impl
+{
+  template <typename T>
+  constexpr
+  bool
+  representable(
+    std::intmax_t v)
+  noexcept
+  {
+    return v < 0
+      ? std::is_signed<T>::value && v >= static_cast<std::intmax_t>(std::numeric_limits<T>::lowest())
+      : static_cast<std::uintmax_t>(v) <= static_cast<std::uintmax_t>(std::numeric_limits<T>::max());
+  }
+
+  constexpr
+  std::intmax_t
+  min_of(
+    std::intmax_t a,
+    std::intmax_t b,
+    std::intmax_t c,
+    std::intmax_t d)
+  noexcept
+  {
+    return a < b ? (a < c ? (a < d ? a : d) : (c < d ? c : d))
+                 : (b < c ? (b < d ? b : d) : (c < d ? c : d));
+  }
+
+  constexpr
+  std::intmax_t
+  max_of(
+    std::intmax_t a,
+    std::intmax_t b,
+    std::intmax_t c,
+    std::intmax_t d)
+  noexcept
+  {
+    return -min_of(-a, -b, -c, -d);
+  }
+
+  template <typename M, std::intmax_t Lo, std::intmax_t Hi>
+  struct replace_bounds
+  {
+    using type = M;
+  };
+
+  template <std::intmax_t L, std::intmax_t H, std::intmax_t Lo, std::intmax_t Hi>
+  struct replace_bounds<bounded<L, H>, Lo, Hi>
+  {
+    using type = bounded<Lo, Hi>;
+  };
+
+  template <typename S, std::intmax_t Lo, std::intmax_t Hi>
+  struct rebound;
+
+  template <typename T, typename Tag, typename ... M, std::intmax_t Lo, std::intmax_t Hi>
+  struct rebound<::strong::type<T, Tag, M...>, Lo, Hi>
+  {
+    using type = ::strong::type<T, Tag, typename replace_bounds<M, Lo, Hi>::type...>;
+  };
+
+  // The strong type S, with strong::bounded<Lo, Hi> in place of its bounds.
+  template <typename S, std::intmax_t Lo, std::intmax_t Hi>
+  using rebound_t = typename rebound<S, Lo, Hi>::type;
+
+  // S and U are bounded types of the same family, i.e. differing only in
+  // the bounds.
+  template <typename S, typename U>
+  using WhenSameBoundedFamily = std::enable_if_t<
+    std::is_same<rebound_t<S, 0, 0>, rebound_t<U, 0, 0>>::value
+  >;
+
+  // The value of the bounded s, with the bounds told to the optimizer in
+  // unchecked builds.
+  template <typename S>
+  STRONG_CONSTEXPR
+  const underlying_type_t<S>&
+  bounded_value(
+    const S& s)
+  noexcept
+  {
+#if !STRONG_CHECKED
+    using T = underlying_type_t<S>;
+    STRONG_ASSUME(static_cast<T>(S::lower_bound::value) <= value_of(s)
+                  && value_of(s) <= static_cast<T>(S::upper_bound::value));
+#endif
+    return value_of(s);
+  }
+
+  // Modifiers that change the value in place, without the check of the
+  // constructor, which would break the invariant of strong::bounded<>.
+  template <typename M>
+  struct changes_value : std::false_type {};
+
+  template <> struct changes_value<arithmetic> : std::true_type {};
+  template <> struct changes_value<bitarithmetic> : std::true_type {};
+  template <> struct changes_value<incrementable> : std::true_type {};
+  template <> struct changes_value<decrementable> : std::true_type {};
+  template <> struct changes_value<difference_operators> : std::true_type {};
+  template <> struct changes_value<istreamable> : std::true_type {};
+  template <> struct changes_value<parsable> : std::true_type {};
+  template <> struct changes_value<serial_number> : std::true_type {};
+  template <> struct changes_value<saturating_arithmetic> : std::true_type {};
+  template <typename P> struct changes_value<checked_arithmetic<P>> : std::true_type {};
+  template <typename D> struct changes_value<affine_point<D>> : std::true_type {};
+  template <typename ... Ts> struct changes_value<arithmetic_with<Ts...>> : std::true_type {};
+
+  template <typename L>
+  struct any_changes_value;
+
+  template <typename ... M>
+  struct any_changes_value<modifier_list<M...>> : any_of<changes_value<M>::value...> {};
+}
+
+template <std::intmax_t Lo, std::intmax_t Hi>
+template <typename T, typename Tag, typename ... M>
+class bounded<Lo, Hi>::modifier<::strong::type<T, Tag, M...>>
+{
+  static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value,
+                "strong::bounded requires an integral underlying type");
+  static_assert(impl::representable<T>(Lo) && impl::representable<T>(Hi),
+                "the bounds of strong::bounded do not fit the underlying type");
+  static_assert(!impl::any_changes_value<decltype(impl::modifiers_of(static_cast<::strong::type<T, Tag, M...>*>(nullptr)))>::value,
+                "strong::bounded cannot be combined with modifiers that change the value in place");
+  using type = ::strong::type<T, Tag, M...>;
+public:
+  using lower_bound = std::integral_constant<std::intmax_t, Lo>;
+  using upper_bound = std::integral_constant<std::intmax_t, Hi>;
+
+  template <typename ... N,
+            typename U = ::strong::type<T, Tag, N...>,
+            typename = impl::WhenSameBoundedFamily<type, U>,
+            typename = std::enable_if_t<(U::lower_bound::value <= Lo && Hi <= U::upper_bound::value)>>
+  STRONG_CONSTEXPR
+  operator ::strong::type<T, Tag, N...>()
+  const
+  noexcept
+  {
+    return U(impl::bounded_value(static_cast<const type&>(*this)));
+  }
+
+  template <typename U, typename = impl::WhenSameBoundedFamily<type, U>>
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  impl::rebound_t<type, Lo + U::lower_bound::value, Hi + U::upper_bound::value>
+  operator+(
+    const type& lh,
+    const U& rh)
+  noexcept
+  {
+    using result = impl::rebound_t<type, Lo + U::lower_bound::value, Hi + U::upper_bound::value>;
+    return result(static_cast<T>(impl::bounded_value(lh) + impl::bounded_value(rh)));
+  }
+
+  template <typename U, typename = impl::WhenSameBoundedFamily<type, U>>
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  impl::rebound_t<type, Lo - U::upper_bound::value, Hi - U::lower_bound::value>
+  operator-(
+    const type& lh,
+    const U& rh)
+  noexcept
+  {
+    using result = impl::rebound_t<type, Lo - U::upper_bound::value, Hi - U::lower_bound::value>;
+    return result(static_cast<T>(impl::bounded_value(lh) - impl::bounded_value(rh)));
+  }
+
+  template <typename U, typename = impl::WhenSameBoundedFamily<type, U>>
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  impl::rebound_t<type,
+                  impl::min_of(Lo * U::lower_bound::value, Lo * U::upper_bound::value,
+                               Hi * U::lower_bound::value, Hi * U::upper_bound::value),
+                  impl::max_of(Lo * U::lower_bound::value, Lo * U::upper_bound::value,
+                               Hi * U::lower_bound::value, Hi * U::upper_bound::value)>
+  operator*(
+    const type& lh,
+    const U& rh)
+  noexcept
+  {
+    using result = impl::rebound_t<type,
+                                   impl::min_of(Lo * U::lower_bound::value, Lo * U::upper_bound::value,
+                                                Hi * U::lower_bound::value, Hi * U::upper_bound::value),
+                                   impl::max_of(Lo * U::lower_bound::value, Lo * U::upper_bound::value,
+                                                Hi * U::lower_bound::value, Hi * U::upper_bound::value)>;
+    return result(static_cast<T>(impl::bounded_value(lh) * impl::bounded_value(rh)));
+  }
+
+  friend
+  STRONG_CONSTEXPR
+  void
+  check_invariant(
+    const type*,
+    const T& v)
+  noexcept(!STRONG_CHECKED)
+  {
+#if STRONG_CHECKED
+    if (v < static_cast<T>(Lo) || v > static_cast<T>(Hi))
+    {
+      throw std::out_of_range("strong::bounded value out of range");
+    }
+#else
+    STRONG_ASSUME(static_cast<T>(Lo) <= v && v <= static_cast<T>(Hi));
+#endif
+  }
+};
+
+// from, converted to the bounded type To of the same family. Only when the
+// interval of From is not contained in that of To can the value be out of
+// range, and then it is checked, like any construction, in checked builds.
+template <typename To, typename From, typename = impl::WhenSameBoundedFamily<To, From>>
+STRONG_NODISCARD
+STRONG_CONSTEXPR
+To
+bounded_cast(
+  const From& from)
+noexcept(noexcept(To(value_of(from))))
+{
+  return To(impl::bounded_value(from));
+}
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_BOUNDED_HPP_INCLUDED
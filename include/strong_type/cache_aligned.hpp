@@ -0,0 +1,45 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_CACHE_ALIGNED_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_CACHE_ALIGNED_HPP_INCLUDED
+
+#include "type.hpp"
+
+#include <new>
+
+// The size, in bytes, that strong::cache_aligned aligns to. GCC warns about
+// the use of std::hardware_destructive_interference_size in headers, since
+// its value may differ between translation units, so it is only used with
+// other compilers.
+#ifndef STRONG_CACHE_LINE_SIZE
+#if defined(__cpp_lib_hardware_interference_size) && !defined(__GNUC__)
+#define STRONG_CACHE_LINE_SIZE std::hardware_destructive_interference_size
+#elif (defined(__aarch64__) && defined(__APPLE__)) || defined(__powerpc64__)
+#define STRONG_CACHE_LINE_SIZE 128
+#else
+#define STRONG_CACHE_LINE_SIZE 64
+#endif
+#endif
+
+namespace strong
+{
+
+struct cache_aligned
+{
+  template <typename T>
+  class alignas(STRONG_CACHE_LINE_SIZE) modifier{};
+};
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_CACHE_ALIGNED_HPP_INCLUDED
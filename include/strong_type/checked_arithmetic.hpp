@@ -0,0 +1,576 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_CHECKED_ARITHMETIC_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_CHECKED_ARITHMETIC_HPP_INCLUDED
+
+#include "type.hpp"
+
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+#if !defined(STRONG_HAS_OVERFLOW_BUILTINS)
+#if defined(__GNUC__) || defined(__clang__)
+#define STRONG_HAS_OVERFLOW_BUILTINS 1
+#else
+#define STRONG_HAS_OVERFLOW_BUILTINS 0
+#endif
+#endif
+
+namespace strong
+{
+
+namespace impl
+{
+  template <typename T>
+  struct is_overflow_checkable
+    : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value>
+  {
+  };
+
+  template <typename T>
+  constexpr bool is_negative(T t, std::true_type) noexcept { return t < T{}; }
+
+  template <typename T>
+  constexpr bool is_negative(T, std::false_type) noexcept { return false; }
+
+  template <typename T>
+  constexpr bool is_negative(T t) noexcept { return is_negative(t, std::is_signed<T>{}); }
+
+  // Branchless overflow detection in unsigned arithmetic, used by the bulk
+  // operations, where it vectorizes, and where the builtins are missing.
+  template <typename T>
+  constexpr bool add_wraps(T a, T b, T& r) noexcept
+  {
+    using U = std::make_unsigned_t<T>;
+    const U ua = static_cast<U>(a);
+    const U ub = static_cast<U>(b);
+    const U ur = static_cast<U>(ua + ub);
+    r = static_cast<T>(ur);
+    return std::is_signed<T>::value
+      ? is_negative(static_cast<T>(static_cast<U>((ua ^ ur) & ~(ua ^ ub))))
+      : ur < ua;
+  }
+
+  template <typename T>
+  constexpr bool sub_wraps(T a, T b, T& r) noexcept
+  {
+    using U = std::make_unsigned_t<T>;
+    const U ua = static_cast<U>(a);
+    const U ub = static_cast<U>(b);
+    const U ur = static_cast<U>(ua - ub);
+    r = static_cast<T>(ur);
+    return std::is_signed<T>::value
+      ? is_negative(static_cast<T>(static_cast<U>((ua ^ ub) & (ua ^ ur))))
+      : ua < ub;
+  }
+
+  template <typename T>
+  constexpr bool mul_wraps(T a, T b, T& r) noexcept
+  {
+    using U = std::common_type_t<std::make_unsigned_t<T>, unsigned>;
+    r = static_cast<T>(static_cast<U>(static_cast<U>(a) * static_cast<U>(b)));
+    if (std::is_signed<T>::value && a == T(-1))
+    {
+      return b == std::numeric_limits<T>::min();
+    }
+    return a != T{} && r / a != b;
+  }
+
+  template <typename T>
+  constexpr bool add_overflow(T a, T b, T& r) noexcept
+  {
+#if STRONG_HAS_OVERFLOW_BUILTINS
+    return __builtin_add_overflow(a, b, &r);
+#else
+    return add_wraps(a, b, r);
+#endif
+  }
+
+  template <typename T>
+  constexpr bool sub_overflow(T a, T b, T& r) noexcept
+  {
+#if STRONG_HAS_OVERFLOW_BUILTINS
+    return __builtin_sub_overflow(a, b, &r);
+#else
+    return sub_wraps(a, b, r);
+#endif
+  }
+
+  template <typename T>
+  constexpr bool mul_overflow(T a, T b, T& r) noexcept
+  {
+#if STRONG_HAS_OVERFLOW_BUILTINS
+    return __builtin_mul_overflow(a, b, &r);
+#else
+    return mul_wraps(a, b, r);
+#endif
+  }
+
+  // Division overflows for min / -1, and is an error for division by zero,
+  // where r becomes 0.
+  template <typename T>
+  constexpr bool div_overflow(T a, T b, T& r) noexcept
+  {
+    if (b == T{})
+    {
+      r = T{};
+      return true;
+    }
+    if (std::is_signed<T>::value && b == T(-1) && a == std::numeric_limits<T>::min())
+    {
+      r = a;
+      return true;
+    }
+    r = static_cast<T>(a / b);
+    return false;
+  }
+
+  template <typename T>
+  struct saturating_ops
+  {
+    static constexpr bool nothrow = true;
+
+    static constexpr T highest() noexcept { return std::numeric_limits<T>::max(); }
+    static constexpr T lowest() noexcept { return std::numeric_limits<T>::min(); }
+
+    static constexpr T negate(T a) noexcept
+    {
+      T r{};
+      return sub_overflow(T{}, a, r) ? (is_negative(a) ? highest() : lowest()) : r;
+    }
+    static constexpr T add(T a, T b) noexcept
+    {
+      T r{};
+      return add_overflow(a, b, r) ? (is_negative(b) ? lowest() : highest()) : r;
+    }
+    static constexpr T sub(T a, T b) noexcept
+    {
+      T r{};
+      return sub_overflow(a, b, r) ? (is_negative(b) ? highest() : lowest()) : r;
+    }
+    static constexpr T mul(T a, T b) noexcept
+    {
+      T r{};
+      return mul_overflow(a, b, r) ? (is_negative(a) != is_negative(b) ? lowest() : highest()) : r;
+    }
+    // Division by zero is as for T.
+    static constexpr T div(T a, T b) noexcept
+    {
+      return std::is_signed<T>::value && b == T(-1) && a == lowest()
+        ? highest()
+        : static_cast<T>(a / b);
+    }
+    // Branchless, for the bulk operations.
+    static constexpr T bulk_add(T a, T b) noexcept
+    {
+      T r{};
+      const bool o = add_wraps(a, b, r);
+      return o ? (is_negative(b) ? lowest() : highest()) : r;
+    }
+    static constexpr T bulk_sub(T a, T b) noexcept
+    {
+      T r{};
+      const bool o = sub_wraps(a, b, r);
+      return o ? (is_negative(b) ? highest() : lowest()) : r;
+    }
+  };
+
+  template <typename T, typename Policy>
+  struct checked_ops
+  {
+    using policy = Policy;
+
+    static constexpr bool nothrow = noexcept(Policy::overflow());
+
+    static constexpr T checked(bool overflow, T r) noexcept(nothrow)
+    {
+      return overflow ? (Policy::overflow(), r) : r;
+    }
+    static constexpr T negate(T a) noexcept(nothrow)
+    {
+      T r{};
+      const bool o = sub_overflow(T{}, a, r);
+      return checked(o, r);
+    }
+    static constexpr T add(T a, T b) noexcept(nothrow)
+    {
+      T r{};
+      const bool o = add_overflow(a, b, r);
+      return checked(o, r);
+    }
+    static constexpr T sub(T a, T b) noexcept(nothrow)
+    {
+      T r{};
+      const bool o = sub_overflow(a, b, r);
+      return checked(o, r);
+    }
+    static constexpr T mul(T a, T b) noexcept(nothrow)
+    {
+      T r{};
+      const bool o = mul_overflow(a, b, r);
+      return checked(o, r);
+    }
+    static constexpr T div(T a, T b) noexcept(nothrow)
+    {
+      T r{};
+      const bool o = div_overflow(a, b, r);
+      return checked(o, r);
+    }
+  };
+
+  // The operators of strong::arithmetic, for the strong type T, with the
+  // operations on the underlying type from Ops.
+  template <typename T, typename Ops>
+  class overflow_arithmetic
+  {
+  public:
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator-(
+      const T &lh)
+    noexcept(Ops::nothrow)
+    {
+      return T{Ops::negate(value_of(lh))};
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator+=(
+      T &lh,
+      const T &rh)
+    noexcept(Ops::nothrow)
+    {
+      value_of(lh) = Ops::add(value_of(lh), value_of(rh));
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator-=(
+      T &lh,
+      const T &rh)
+    noexcept(Ops::nothrow)
+    {
+      value_of(lh) = Ops::sub(value_of(lh), value_of(rh));
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator*=(
+      T &lh,
+      const T &rh)
+    noexcept(Ops::nothrow)
+    {
+      value_of(lh) = Ops::mul(value_of(lh), value_of(rh));
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    T&
+    operator/=(
+      T &lh,
+      const T &rh)
+    noexcept(Ops::nothrow)
+    {
+      value_of(lh) = Ops::div(value_of(lh), value_of(rh));
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator+(
+      T lh,
+      const T &rh)
+    noexcept(Ops::nothrow)
+    {
+      lh += rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator-(
+      T lh,
+      const T &rh)
+    noexcept(Ops::nothrow)
+    {
+      lh -= rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator*(
+      T lh,
+      const T &rh)
+    noexcept(Ops::nothrow)
+    {
+      lh *= rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    T
+    operator/(
+      T lh,
+      const T &rh)
+    noexcept(Ops::nothrow)
+    {
+      lh /= rh;
+      return lh;
+    }
+  };
+
+  template <typename T, typename Ops>
+  Ops overflow_ops_of(const overflow_arithmetic<T, Ops>*);
+
+  template <typename S>
+  using overflow_ops_t = decltype(overflow_ops_of(static_cast<const S*>(nullptr)));
+}
+
+// Like strong::arithmetic, for integral underlying types, but results that do
+// not fit are clamped to the nearest representable value instead of wrapping.
+struct saturating_arithmetic
+{
+  template <typename T>
+  class modifier
+    : public impl::overflow_arithmetic<T, impl::saturating_ops<underlying_type_t<T>>>
+  {
+    static_assert(impl::is_overflow_checkable<underlying_type_t<T>>::value,
+                  "saturating_arithmetic requires an integral underlying type");
+  };
+};
+
+class overflow_error : public std::overflow_error
+{
+public:
+  using std::overflow_error::overflow_error;
+};
+
+// Policies for strong::checked_arithmetic<Policy>. Policy::overflow() is
+// called when a result does not fit, or on division by zero, and if it
+// returns, the result is the wrapped value, or 0 after division by zero.
+struct throw_on_overflow
+{
+  [[noreturn]] static void overflow()
+  {
+    throw ::strong::overflow_error("strong::checked_arithmetic overflow");
+  }
+};
+
+struct trap_on_overflow
+{
+  [[noreturn]] static void overflow() noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_trap();
+#else
+    std::abort();
+#endif
+  }
+};
+
+// Raises a sticky flag for the calling thread, like the floating point
+// exception flags of <cfenv>.
+struct flag_on_overflow
+{
+  static void overflow() noexcept { flag() = true; }
+
+  STRONG_NODISCARD
+  static bool test() noexcept { return flag(); }
+
+  static void clear() noexcept { flag() = false; }
+
+  STRONG_NODISCARD
+  static bool test_and_clear() noexcept
+  {
+    const bool raised = flag();
+    flag() = false;
+    return raised;
+  }
+private:
+  static bool& flag() noexcept
+  {
+    thread_local bool raised = false;
+    return raised;
+  }
+};
+
+// Like strong::arithmetic, for integral underlying types, but results that do
+// not fit, and division by zero, are reported to Policy.
+template <typename Policy = throw_on_overflow>
+struct checked_arithmetic
+{
+  template <typename T>
+  class modifier
+    : public impl::overflow_arithmetic<T, impl::checked_ops<underlying_type_t<T>, Policy>>
+  {
+    static_assert(impl::is_overflow_checkable<underlying_type_t<T>>::value,
+                  "checked_arithmetic requires an integral underlying type");
+  };
+};
+
+// Element wise operations on arrays of count values, out[i] = lhs[i] op rhs[i],
+// for types with strong::saturating_arithmetic. Addition and subtraction are
+// branchless so that the loops vectorize.
+template <typename S>
+void
+saturating_add(
+  const S* lhs,
+  const S* rhs,
+  std::size_t count,
+  S* out)
+noexcept
+{
+  using ops = impl::saturating_ops<underlying_type_t<S>>;
+  static_assert(std::is_same<impl::overflow_ops_t<S>, ops>::value,
+                "saturating_add requires a type with saturating_arithmetic");
+  for (std::size_t i = 0; i != count; ++i)
+  {
+    out[i] = S{ops::bulk_add(value_of(lhs[i]), value_of(rhs[i]))};
+  }
+}
+
+template <typename S>
+void
+saturating_sub(
+  const S* lhs,
+  const S* rhs,
+  std::size_t count,
+  S* out)
+noexcept
+{
+  using ops = impl::saturating_ops<underlying_type_t<S>>;
+  static_assert(std::is_same<impl::overflow_ops_t<S>, ops>::value,
+                "saturating_sub requires a type with saturating_arithmetic");
+  for (std::size_t i = 0; i != count; ++i)
+  {
+    out[i] = S{ops::bulk_sub(value_of(lhs[i]), value_of(rhs[i]))};
+  }
+}
+
+template <typename S>
+void
+saturating_mul(
+  const S* lhs,
+  const S* rhs,
+  std::size_t count,
+  S* out)
+noexcept
+{
+  using ops = impl::saturating_ops<underlying_type_t<S>>;
+  static_assert(std::is_same<impl::overflow_ops_t<S>, ops>::value,
+                "saturating_mul requires a type with saturating_arithmetic");
+  for (std::size_t i = 0; i != count; ++i)
+  {
+    out[i] = S{ops::mul(value_of(lhs[i]), value_of(rhs[i]))};
+  }
+}
+
+namespace impl
+{
+  template <typename S, typename Op>
+  bool
+  checked_bulk(
+    const S* lhs,
+    const S* rhs,
+    std::size_t count,
+    S* out,
+    Op op)
+  noexcept(overflow_ops_t<S>::nothrow)
+  {
+    using T = underlying_type_t<S>;
+    static_assert(std::is_same<overflow_ops_t<S>,
+                               checked_ops<T, typename overflow_ops_t<S>::policy>>::value,
+                  "requires a type with checked_arithmetic");
+    unsigned overflow = 0;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+      T r{};
+      overflow |= op(value_of(lhs[i]), value_of(rhs[i]), r);
+      out[i] = S{r};
+    }
+    if (overflow)
+    {
+      overflow_ops_t<S>::policy::overflow();
+    }
+    return overflow != 0;
+  }
+}
+
+// Element wise operations on arrays of count values, out[i] = lhs[i] op rhs[i],
+// for types with strong::checked_arithmetic<Policy>. All elements are
+// computed, wrapping on overflow, and the policy is called once at the end if
+// any of them overflowed. Returns true if any overflowed. Addition and
+// subtraction are branchless so that the loops vectorize.
+template <typename S>
+bool
+checked_add(
+  const S* lhs,
+  const S* rhs,
+  std::size_t count,
+  S* out)
+noexcept(impl::overflow_ops_t<S>::nothrow)
+{
+  using T = underlying_type_t<S>;
+  return impl::checked_bulk(lhs, rhs, count, out,
+                            [](T a, T b, T& r) noexcept { return impl::add_wraps(a, b, r); });
+}
+
+template <typename S>
+bool
+checked_sub(
+  const S* lhs,
+  const S* rhs,
+  std::size_t count,
+  S* out)
+noexcept(impl::overflow_ops_t<S>::nothrow)
+{
+  using T = underlying_type_t<S>;
+  return impl::checked_bulk(lhs, rhs, count, out,
+                            [](T a, T b, T& r) noexcept { return impl::sub_wraps(a, b, r); });
+}
+
+template <typename S>
+bool
+checked_mul(
+  const S* lhs,
+  const S* rhs,
+  std::size_t count,
+  S* out)
+noexcept(impl::overflow_ops_t<S>::nothrow)
+{
+  using T = underlying_type_t<S>;
+  return impl::checked_bulk(lhs, rhs, count, out,
+                            [](T a, T b, T& r) noexcept { return impl::mul_overflow(a, b, r); });
+}
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_CHECKED_ARITHMETIC_HPP_INCLUDED
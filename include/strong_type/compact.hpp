@@ -0,0 +1,150 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_COMPACT_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_COMPACT_HPP_INCLUDED
+
+#include "serializable.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+
+namespace strong
+{
+
+namespace impl
+{
+  template <typename S>
+  using widened_t = std::conditional_t<std::is_signed<S>::value, std::int64_t, std::uint64_t>;
+}
+
+// An underlying type for strong::type that stores the value in the narrow
+// integral type S, and widens it to V on access, so that arithmetic is done
+// in V. Storing a value that does not fit in S is checked in checked builds,
+// and truncates otherwise. Equality compares the stored values.
+template <typename S, typename V = impl::widened_t<S>>
+class compact
+  : public impl::storage_operators<compact<S, V>, V>
+{
+  static_assert(std::is_integral<S>::value && !std::is_same<S, bool>::value,
+                "storage type must be an integral type");
+  static_assert(std::is_integral<V>::value && sizeof(V) >= sizeof(S),
+                "value type must be an integral type at least as wide as the storage type");
+public:
+  using value_type = V;
+  using storage_type = S;
+
+  compact() = default;
+
+  STRONG_CONSTEXPR
+  explicit
+  compact(
+    V v)
+  noexcept(!STRONG_CHECKED)
+  : stored_(narrow(v))
+  {
+  }
+
+  STRONG_CONSTEXPR
+  compact&
+  operator=(
+    V v)
+  noexcept(!STRONG_CHECKED)
+  {
+    store(v);
+    return *this;
+  }
+
+  constexpr operator V() const noexcept { return load(); }
+
+  STRONG_NODISCARD
+  constexpr
+  V
+  load()
+  const
+  noexcept
+  {
+    return static_cast<V>(stored_);
+  }
+
+  STRONG_CONSTEXPR
+  void
+  store(
+    V v)
+  noexcept(!STRONG_CHECKED)
+  {
+    stored_ = narrow(v);
+  }
+
+  STRONG_NODISCARD
+  friend
+  constexpr
+  bool
+  operator==(
+    const compact& lh,
+    const compact& rh)
+  noexcept
+  {
+    return lh.stored_ == rh.stored_;
+  }
+
+  STRONG_NODISCARD
+  friend
+  constexpr
+  bool
+  operator!=(
+    const compact& lh,
+    const compact& rh)
+  noexcept
+  {
+    return !(lh == rh);
+  }
+private:
+  static
+  STRONG_CONSTEXPR
+  S
+  narrow(
+    V v)
+  noexcept(!STRONG_CHECKED)
+  {
+#if STRONG_CHECKED
+    if (static_cast<V>(static_cast<S>(v)) != v
+        || (static_cast<S>(v) < S{}) != (v < V{}))
+    {
+      throw std::out_of_range("strong::compact value does not fit the storage type");
+    }
+#endif
+    return static_cast<S>(v);
+  }
+
+  S stored_;
+};
+
+}
+
+namespace std {
+template <typename S, typename V>
+struct hash<::strong::compact<S, V>>
+{
+  decltype(auto)
+  operator()(
+    const ::strong::compact<S, V>& t)
+  const
+  noexcept(noexcept(std::declval<hash<V>>()(std::declval<V>())))
+  {
+    return hash<V>{}(t.load());
+  }
+};
+}
+#endif //ROLLBEAR_STRONG_TYPE_COMPACT_HPP_INCLUDED
@@ -0,0 +1,140 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_DIFFERENCE_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_DIFFERENCE_HPP_INCLUDED
+
+#include "ordered.hpp"
+
+namespace strong
+{
+
+namespace impl
+{
+  struct difference_operators
+  {
+    template <typename T>
+    class modifier;
+  };
+
+  template <typename T, typename Tag, typename ... M>
+  class difference_operators::modifier<::strong::type<T, Tag, M...>>
+  {
+    using type = ::strong::type<T, Tag, M...>;
+  public:
+    friend
+    STRONG_CONSTEXPR
+    type& operator+=(type& lh, const type& rh)
+    noexcept(noexcept(value_of(lh) += value_of(rh)))
+    {
+      value_of(lh) += value_of(rh);
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type& operator-=(type& lh, const type& rh)
+      noexcept(noexcept(value_of(lh) -= value_of(rh)))
+    {
+      value_of(lh) -= value_of(rh);
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type& operator*=(type& lh, const T& rh)
+    noexcept(noexcept(value_of(lh) *= rh))
+    {
+      value_of(lh) *= rh;
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type& operator/=(type& lh, const T& rh)
+      noexcept(noexcept(value_of(lh) /= rh))
+    {
+      value_of(lh) /= rh;
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type operator+(type lh, const type& rh)
+      noexcept(noexcept(lh += rh) && std::is_nothrow_move_constructible<type>::value)
+    {
+      lh += rh;
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type operator-(type lh, const type& rh)
+      noexcept(noexcept(lh -= rh) && std::is_nothrow_move_constructible<type>::value)
+    {
+      lh -= rh;
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type operator*(type lh, const T& rh)
+      noexcept(noexcept(lh *= rh) && std::is_nothrow_move_constructible<type>::value)
+    {
+      lh *= rh;
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type operator*(const T& lh, type rh)
+      noexcept(noexcept(rh *= lh) && std::is_nothrow_move_constructible<type>::value)
+    {
+      rh *= lh;
+      return rh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type operator/(type lh, const T& rh)
+      noexcept(noexcept(lh /= rh) && std::is_nothrow_move_constructible<type>::value)
+    {
+      lh /= rh;
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    T operator/(const type& lh, const type& rh)
+      noexcept(noexcept(value_of(lh) / value_of(rh)))
+    {
+      return value_of(lh) / value_of(rh);
+    }
+  };
+}
+
+struct difference
+{
+  template <typename>
+  using expands_to = impl::modifier_list<ordered, impl::difference_operators>;
+
+  template <typename T>
+  class modifier
+    : public ordered::modifier<T>
+    , public impl::difference_operators::modifier<T>
+  {
+  };
+};
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_DIFFERENCE_HPP_INCLUDED
@@ -0,0 +1,610 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_FIXED_POINT_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_FIXED_POINT_HPP_INCLUDED
+
+#include "equality.hpp"
+#include "hashable.hpp"
+#include "ordered.hpp"
+#include "parsable.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#if !defined(STRONG_HAS_INT128)
+#if defined(__SIZEOF_INT128__)
+#define STRONG_HAS_INT128 1
+#else
+#define STRONG_HAS_INT128 0
+#endif
+#endif
+
+namespace strong
+{
+
+// The scale of a strong::fixed_point<>, where the underlying value is the
+// number of 10^-Digits, or of 2^-Bits.
+template <int Digits>
+struct decimal {};
+
+template <int Bits>
+struct fraction_bits {};
+
+// Rounding policies for the rescaling multiplication and division of
+// strong::fixed_point<>, and for parsing.
+struct round_toward_zero
+{
+  template <typename W>
+  static constexpr W divide(W n, W d) noexcept
+  {
+    return n / d;
+  }
+};
+
+struct round_down
+{
+  template <typename W>
+  static constexpr W divide(W n, W d) noexcept
+  {
+    return n % d != 0 && (n % d < 0) != (d < 0) ? n / d - 1 : n / d;
+  }
+};
+
+struct round_up
+{
+  template <typename W>
+  static constexpr W divide(W n, W d) noexcept
+  {
+    return n % d != 0 && (n % d < 0) == (d < 0) ? n / d + 1 : n / d;
+  }
+};
+
+struct round_half_away_from_zero
+{
+  template <typename W>
+  static constexpr W divide(W n, W d) noexcept
+  {
+    const W q = n / d;
+    const W r = n % d < 0 ? -(n % d) : n % d;
+    const W ad = d < 0 ? -d : d;
+    return r >= ad - r ? ((n < 0) != (d < 0) ? q - 1 : q + 1) : q;
+  }
+};
+
+struct round_half_even
+{
+  template <typename W>
+  static constexpr W divide(W n, W d) noexcept
+  {
+    const W q = n / d;
+    const W r = n % d < 0 ? -(n % d) : n % d;
+    const W ad = d < 0 ? -d : d;
+    return r > ad - r || (r == ad - r && q % 2 != 0)
+      ? ((n < 0) != (d < 0) ? q - 1 : q + 1)
+      : q;
+  }
+};
+
+namespace impl
+{
+#if STRONG_HAS_INT128
+  __extension__ typedef __int128 int128;
+#endif
+
+  // The type that products of Rep are computed in before rescaling.
+  template <typename Rep, bool = (sizeof(Rep) <= sizeof(std::int32_t))>
+  struct fixed_wide
+  {
+    using type = std::int64_t;
+  };
+
+#if STRONG_HAS_INT128
+  template <typename Rep>
+  struct fixed_wide<Rep, false>
+  {
+    using type = int128;
+  };
+#endif
+
+  template <typename W>
+  constexpr W pow10(int n) noexcept
+  {
+    return n == 0 ? W{1} : W{10} * pow10<W>(n - 1);
+  }
+
+  // a * b / d, computed exactly and rounded with Rounding. A 64 bit Rep uses
+  // 128 bit arithmetic only when a * b overflows, since the compilers call a
+  // library function for 128 bit division.
+  template <typename Rounding, typename Rep>
+  constexpr Rep muldiv(Rep a, Rep b, Rep d) noexcept
+  {
+    using W = typename fixed_wide<Rep>::type;
+#if STRONG_HAS_INT128
+    Rep p{};
+    return sizeof(Rep) > sizeof(std::int32_t) && !__builtin_mul_overflow(a, b, &p) && d != -1
+      ? Rounding::divide(p, d)
+      : static_cast<Rep>(Rounding::divide(W{a} * W{b}, W{d}));
+#else
+    return static_cast<Rep>(Rounding::divide(W{a} * W{b}, W{d}));
+#endif
+  }
+
+  template <typename Rep, typename Scale>
+  struct fixed_scale;
+
+  template <typename Rep, int Digits>
+  struct fixed_scale<Rep, decimal<Digits>>
+  {
+    static_assert(Digits >= 0 && Digits <= std::numeric_limits<Rep>::digits10,
+                  "too many decimal digits for the underlying type");
+    using wide = typename fixed_wide<Rep>::type;
+    static constexpr bool is_decimal = true;
+    static constexpr int digits = Digits;
+    static constexpr wide factor() noexcept { return pow10<wide>(Digits); }
+  };
+
+  template <typename Rep, int Bits>
+  struct fixed_scale<Rep, fraction_bits<Bits>>
+  {
+    static_assert(Bits >= 0 && Bits <= std::numeric_limits<Rep>::digits - 4,
+                  "too many fraction bits for the underlying type");
+    using wide = typename fixed_wide<Rep>::type;
+    static constexpr bool is_decimal = false;
+    static constexpr int digits = Bits;
+    static constexpr wide factor() noexcept { return wide{1} << Bits; }
+  };
+
+  template <typename Rep>
+  struct fixed_parse_result
+  {
+    const char* ptr;
+    Rep raw;
+    bool valid;
+    bool in_range;
+  };
+
+  // Parses [first, last) as an optional '-', decimal digits, and optionally a
+  // '.' followed by decimal digits, into the underlying value of a fixed
+  // point number with the given Scale, rounded with Rounding from the exact
+  // value of all the digits.
+  template <typename Rep, typename Scale, typename Rounding>
+  constexpr
+  fixed_parse_result<Rep>
+  parse_fixed(
+    const char* first,
+    const char* last)
+  noexcept
+  {
+    using scale = fixed_scale<Rep, Scale>;
+    using W = typename scale::wide;
+    const W factor = scale::factor();
+    const W limit = W{std::numeric_limits<Rep>::max()} / factor + 1;
+    const char* p = first;
+    const bool negative = p != last && *p == '-';
+    if (negative) ++p;
+    W integer{};
+    bool in_range = true;
+    const char* digits = p;
+    for (; p != last && *p >= '0' && *p <= '9'; ++p)
+    {
+      if (integer < limit) integer = integer * 10 + (*p - '0');
+      else in_range = false;
+    }
+    bool valid = p != digits;
+    // The fraction times factor, as the whole part and the decimal digits
+    // of the rest, computed exactly from the last digit to the first, so
+    // that every digit counts in the rounding. Only the first digit of the
+    // rest, and whether any other is non zero, are kept.
+    W fraction{};
+    int first_rest = 0;
+    bool more_rest = false;
+    if (p != last && *p == '.')
+    {
+      const char* fraction_digits = ++p;
+      while (p != last && *p >= '0' && *p <= '9') ++p;
+      for (const char* d = p; d != fraction_digits; )
+      {
+        const W t = (*--d - '0') * factor + fraction;
+        more_rest = more_rest || first_rest != 0;
+        first_rest = static_cast<int>(t % 10);
+        fraction = t / 10;
+      }
+      valid = valid || p != fraction_digits;
+    }
+    if (!valid) return { first, Rep{}, false, false };
+    if (integer >= limit) in_range = false;
+    // The magnitude in quarters of the last unit, with the rest reduced to
+    // 0, less than a half, a half, or more than a half, which is all that
+    // any rounding policy needs, and rounded with a single division.
+    const W rest = first_rest == 0 && !more_rest ? 0
+                 : first_rest < 5 ? 1
+                 : first_rest == 5 && !more_rest ? 2
+                 : 3;
+    const W quarters = (integer * factor + fraction) * 4 + rest;
+    const W raw = Rounding::divide(negative ? -quarters : quarters, W{4});
+    in_range = in_range
+      && raw >= W{std::numeric_limits<Rep>::min()}
+      && raw <= W{std::numeric_limits<Rep>::max()};
+    return { p, static_cast<Rep>(raw), true, in_range };
+  }
+
+  template <typename Scale, typename Rounding>
+  struct fixed_point_arithmetic
+  {
+    template <typename T>
+    class modifier;
+  };
+
+  template <typename Scale, typename Rounding>
+  template <typename Rep, typename Tag, typename ... M>
+  class fixed_point_arithmetic<Scale, Rounding>::modifier<::strong::type<Rep, Tag, M...>>
+  {
+    static_assert(std::is_integral<Rep>::value && std::is_signed<Rep>::value,
+                  "fixed_point requires a signed integral underlying type");
+    static_assert(sizeof(Rep) <= sizeof(std::int32_t) || STRONG_HAS_INT128,
+                  "fixed_point with a 64 bit underlying type requires __int128");
+    using type = ::strong::type<Rep, Tag, M...>;
+    using scale = fixed_scale<Rep, Scale>;
+  public:
+    using rounding = Rounding;
+
+    // The number of decimal digits, or of fraction bits.
+    static constexpr int fraction_digits = scale::digits;
+
+    // The underlying value of 1.
+    STRONG_NODISCARD
+    static
+    constexpr
+    Rep
+    scale_factor()
+    noexcept
+    {
+      return static_cast<Rep>(scale::factor());
+    }
+
+    STRONG_NODISCARD
+    static
+    STRONG_CONSTEXPR
+    type
+    from_integer(
+      Rep i)
+    noexcept
+    {
+      return type{static_cast<Rep>(i * scale::factor())};
+    }
+
+    // Rounded to nearest, with ties away from zero.
+    STRONG_NODISCARD
+    static
+    STRONG_CONSTEXPR
+    type
+    from_double(
+      double d)
+    noexcept
+    {
+      return type{static_cast<Rep>(d * static_cast<double>(scale::factor()) + (d < 0 ? -0.5 : 0.5))};
+    }
+
+    // From a decimal literal, like "12.34" or "-0.5", rounded with the
+    // rounding policy. Throws std::invalid_argument for text that is not a
+    // number, and std::out_of_range for numbers that do not fit, which does
+    // not compile in a constant expression.
+    template <std::size_t N>
+    STRONG_NODISCARD
+    static
+    STRONG_CONSTEXPR
+    type
+    from_literal(
+      const char (&text)[N])
+    {
+      const auto r = parse_fixed<Rep, Scale, Rounding>(text, text + N - 1);
+      return !r.valid || r.ptr != text + N - 1
+        ? throw std::invalid_argument("strong::fixed_point literal is not a number")
+        : !r.in_range
+        ? throw std::out_of_range("strong::fixed_point literal is out of range")
+        : type{r.raw};
+    }
+
+    STRONG_NODISCARD
+    STRONG_CONSTEXPR
+    double
+    to_double()
+    const
+    noexcept
+    {
+      auto& self = static_cast<const type&>(*this);
+      return static_cast<double>(value_of(self)) / static_cast<double>(scale::factor());
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator-(
+      const type& t)
+    noexcept
+    {
+      return type{static_cast<Rep>(-value_of(t))};
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator+=(
+      type& lh,
+      const type& rh)
+    noexcept
+    {
+      value_of(lh) += value_of(rh);
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator-=(
+      type& lh,
+      const type& rh)
+    noexcept
+    {
+      value_of(lh) -= value_of(rh);
+      return lh;
+    }
+
+    // The exact product is rescaled with the rounding policy.
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator*=(
+      type& lh,
+      const type& rh)
+    noexcept
+    {
+      value_of(lh) = muldiv<Rounding>(value_of(lh), value_of(rh), scale_factor());
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator/=(
+      type& lh,
+      const type& rh)
+    noexcept
+    {
+      value_of(lh) = muldiv<Rounding>(value_of(lh), scale_factor(), value_of(rh));
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator*=(
+      type& lh,
+      Rep rh)
+    noexcept
+    {
+      value_of(lh) *= rh;
+      return lh;
+    }
+
+    friend
+    STRONG_CONSTEXPR
+    type&
+    operator/=(
+      type& lh,
+      Rep rh)
+    noexcept
+    {
+      value_of(lh) = Rounding::divide(value_of(lh), rh);
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator+(
+      type lh,
+      const type& rh)
+    noexcept
+    {
+      lh += rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator-(
+      type lh,
+      const type& rh)
+    noexcept
+    {
+      lh -= rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator*(
+      type lh,
+      const type& rh)
+    noexcept
+    {
+      lh *= rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator/(
+      type lh,
+      const type& rh)
+    noexcept
+    {
+      lh /= rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator*(
+      type lh,
+      Rep rh)
+    noexcept
+    {
+      lh *= rh;
+      return lh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator*(
+      Rep lh,
+      type rh)
+    noexcept
+    {
+      rh *= lh;
+      return rh;
+    }
+
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    type
+    operator/(
+      type lh,
+      Rep rh)
+    noexcept
+    {
+      lh /= rh;
+      return lh;
+    }
+
+#if STRONG_HAS_CHARCONV
+    // The shortest exact decimal representation for fraction_bits<>, and
+    // always all digits for decimal<>.
+    friend
+    std::to_chars_result
+    to_chars(
+      char* first,
+      char* last,
+      const type& t)
+    noexcept
+    {
+      using W = typename scale::wide;
+      W magnitude = value_of(t) < 0 ? -W{value_of(t)} : W{value_of(t)};
+      if (value_of(t) < 0)
+      {
+        if (first == last) return { last, std::errc::value_too_large };
+        *first++ = '-';
+      }
+      const W factor = scale::factor();
+      auto r = std::to_chars(first, last, static_cast<unsigned long long>(magnitude / factor));
+      if (r.ec != std::errc{}) return r;
+      W fraction = magnitude % factor;
+      if (scale::is_decimal)
+      {
+        if (scale::digits == 0) return r;
+        if (last - r.ptr < scale::digits + 1) return { last, std::errc::value_too_large };
+        *r.ptr = '.';
+        for (int i = scale::digits; i != 0; --i)
+        {
+          r.ptr[i] = static_cast<char>('0' + static_cast<int>(fraction % 10));
+          fraction /= 10;
+        }
+        r.ptr += scale::digits + 1;
+        return r;
+      }
+      if (fraction == 0) return r;
+      if (r.ptr == last) return { last, std::errc::value_too_large };
+      *r.ptr++ = '.';
+      while (fraction != 0)
+      {
+        if (r.ptr == last) return { last, std::errc::value_too_large };
+        fraction *= 10;
+        *r.ptr++ = static_cast<char>('0' + static_cast<int>(fraction / factor));
+        fraction %= factor;
+      }
+      return r;
+    }
+
+    // Accepts the format of from_literal(), rounding with the rounding policy.
+    friend
+    std::from_chars_result
+    from_chars(
+      const char* first,
+      const char* last,
+      type& t)
+    noexcept
+    {
+      const auto r = parse_fixed<Rep, Scale, Rounding>(first, last);
+      if (!r.valid) return { first, std::errc::invalid_argument };
+      if (!r.in_range) return { r.ptr, std::errc::result_out_of_range };
+      value_of(t) = r.raw;
+      return { r.ptr, std::errc{} };
+    }
+#endif
+  };
+}
+
+// a * b or a / b for a fixed point type, rescaled with the given rounding
+// policy instead of the one of the type.
+template <typename Rounding, typename F>
+STRONG_NODISCARD
+STRONG_CONSTEXPR
+F
+fixed_multiply(
+  const F& a,
+  const F& b)
+noexcept
+{
+  return F{impl::muldiv<Rounding>(value_of(a), value_of(b), F::scale_factor())};
+}
+
+template <typename Rounding, typename F>
+STRONG_NODISCARD
+STRONG_CONSTEXPR
+F
+fixed_divide(
+  const F& a,
+  const F& b)
+noexcept
+{
+  return F{impl::muldiv<Rounding>(value_of(a), F::scale_factor(), value_of(b))};
+}
+
+// A fixed point number with the scale decimal<Digits> or fraction_bits<Bits>,
+// stored as a signed integer Rep. Addition and subtraction are those of Rep,
+// and multiplication and division are computed exactly in a wider integer
+// type and rescaled with the Rounding policy.
+template <typename Rep, typename Scale, typename Tag,
+          typename Rounding = round_half_even, typename ... M>
+using fixed_point = type<Rep, Tag,
+                         impl::fixed_point_arithmetic<Scale, Rounding>,
+                         equality, ordered, hashable, M...>;
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_FIXED_POINT_HPP_INCLUDED
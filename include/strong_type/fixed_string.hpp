@@ -0,0 +1,320 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_FIXED_STRING_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_FIXED_STRING_HPP_INCLUDED
+
+#include "equality.hpp"
+#include "hashable.hpp"
+#include "ordered.hpp"
+#include "serializable.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iosfwd>
+#include <stdexcept>
+#include <string>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace strong
+{
+
+namespace impl
+{
+  inline std::uint64_t byteswap(std::uint64_t w) noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(w);
+#else
+    w = ((w & 0x00ff00ff00ff00ffULL) << 8) | ((w >> 8) & 0x00ff00ff00ff00ffULL);
+    w = ((w & 0x0000ffff0000ffffULL) << 16) | ((w >> 16) & 0x0000ffff0000ffffULL);
+    return (w << 32) | (w >> 32);
+#endif
+  }
+}
+
+// An underlying type for strong::type that stores up to N characters inline,
+// zero padded to a whole number of 64 bit words, so that it is trivially
+// copyable and never allocates. Equality and ordering compare a word at a
+// time, and the ordering is that of std::string. The text cannot contain NUL
+// characters, since the padding marks the end. The constructors are
+// constexpr.
+template <std::size_t N>
+class inline_string
+{
+  static_assert(N > 0, "strong::inline_string<N> requires N > 0");
+  static constexpr std::size_t words = (N + 7) / 8;
+public:
+  constexpr inline_string() noexcept = default;
+
+  // From a string literal, which must fit. The text ends at the first NUL.
+  template <std::size_t M>
+  constexpr
+  explicit
+  inline_string(
+    const char (&literal)[M])
+  noexcept
+  {
+    static_assert(M - 1 <= N, "string literal does not fit strong::inline_string<N>");
+    for (std::size_t i = 0; i != M - 1 && literal[i] != '\0'; ++i) chars_[i] = literal[i];
+  }
+
+  STRONG_CONSTEXPR
+  inline_string(
+    const char* text,
+    std::size_t size)
+  {
+    if (size > N) throw std::length_error("text does not fit strong::inline_string<N>");
+    for (std::size_t i = 0; i != size; ++i)
+    {
+      if (text[i] == '\0') throw std::invalid_argument("strong::inline_string text cannot contain NUL");
+      chars_[i] = text[i];
+    }
+  }
+
+  explicit
+  inline_string(
+    const std::string& text)
+  : inline_string(text.data(), text.size())
+  {
+  }
+
+#if __cplusplus >= 201703L
+  constexpr
+  explicit
+  inline_string(
+    std::string_view text)
+  : inline_string(text.data(), text.size())
+  {
+  }
+
+  STRONG_NODISCARD
+  constexpr
+  std::string_view
+  view()
+  const
+  noexcept
+  {
+    return std::string_view(data(), size());
+  }
+#endif
+
+  STRONG_NODISCARD
+  static
+  constexpr
+  std::size_t
+  capacity()
+  noexcept
+  {
+    return N;
+  }
+
+  // Not NUL terminated when the string is full.
+  STRONG_NODISCARD
+  constexpr
+  const char*
+  data()
+  const
+  noexcept
+  {
+    return chars_;
+  }
+
+  STRONG_NODISCARD
+  STRONG_CONSTEXPR
+  std::size_t
+  size()
+  const
+  noexcept
+  {
+    std::size_t n = 0;
+    while (n != N && chars_[n] != '\0') ++n;
+    return n;
+  }
+
+  STRONG_NODISCARD
+  constexpr
+  bool
+  empty()
+  const
+  noexcept
+  {
+    return chars_[0] == '\0';
+  }
+
+  STRONG_NODISCARD
+  constexpr
+  char
+  operator[](
+    std::size_t i)
+  const
+  noexcept
+  {
+    return chars_[i];
+  }
+
+  STRONG_NODISCARD
+  std::string
+  str()
+  const
+  {
+    return std::string(data(), size());
+  }
+
+  STRONG_NODISCARD
+  std::size_t
+  hash()
+  const
+  noexcept
+  {
+    std::uint64_t h = N;
+    for (std::size_t i = 0; i != words; ++i)
+    {
+      h = (h ^ word(i)) * 0x9e3779b97f4a7c15ULL;
+      h ^= h >> 32;
+    }
+    return static_cast<std::size_t>(h);
+  }
+
+  STRONG_NODISCARD
+  friend
+  bool
+  operator==(
+    const inline_string& lh,
+    const inline_string& rh)
+  noexcept
+  {
+    bool equal = true;
+    for (std::size_t i = 0; i != words; ++i) equal &= lh.word(i) == rh.word(i);
+    return equal;
+  }
+
+  STRONG_NODISCARD
+  friend
+  bool
+  operator!=(
+    const inline_string& lh,
+    const inline_string& rh)
+  noexcept
+  {
+    return !(lh == rh);
+  }
+
+  STRONG_NODISCARD
+  friend
+  bool
+  operator<(
+    const inline_string& lh,
+    const inline_string& rh)
+  noexcept
+  {
+    return compare(lh, rh) < 0;
+  }
+
+  STRONG_NODISCARD
+  friend
+  bool
+  operator<=(
+    const inline_string& lh,
+    const inline_string& rh)
+  noexcept
+  {
+    return compare(lh, rh) <= 0;
+  }
+
+  STRONG_NODISCARD
+  friend
+  bool
+  operator>(
+    const inline_string& lh,
+    const inline_string& rh)
+  noexcept
+  {
+    return compare(lh, rh) > 0;
+  }
+
+  STRONG_NODISCARD
+  friend
+  bool
+  operator>=(
+    const inline_string& lh,
+    const inline_string& rh)
+  noexcept
+  {
+    return compare(lh, rh) >= 0;
+  }
+
+  template <typename Traits>
+  friend
+  std::basic_ostream<char, Traits>&
+  operator<<(
+    std::basic_ostream<char, Traits>& os,
+    const inline_string& s)
+  {
+    return os.write(s.data(), static_cast<decltype(os.width())>(s.size()));
+  }
+private:
+  std::uint64_t word(std::size_t i) const noexcept
+  {
+    std::uint64_t w;
+    std::memcpy(&w, chars_ + i * 8, sizeof(w));
+    return w;
+  }
+
+  // The words loaded most significant byte first compare like the bytes,
+  // as unsigned char, and the zero padding makes a prefix less.
+  static int compare(const inline_string& lh, const inline_string& rh) noexcept
+  {
+    for (std::size_t i = 0; i != words; ++i)
+    {
+      auto l = lh.word(i);
+      auto r = rh.word(i);
+      if (l != r)
+      {
+        if (endian::native == endian::little)
+        {
+          l = impl::byteswap(l);
+          r = impl::byteswap(r);
+        }
+        return l < r ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+  alignas(std::uint64_t) char chars_[words * 8] = {};
+};
+
+template <std::size_t N, typename Tag, typename ... M>
+using fixed_string = type<inline_string<N>, Tag, default_constructible, equality, ordered, hashable, M...>;
+
+}
+
+namespace std {
+template <std::size_t N>
+struct hash<::strong::inline_string<N>>
+{
+  size_t
+  operator()(
+    const ::strong::inline_string<N>& s)
+  const
+  noexcept
+  {
+    return s.hash();
+  }
+};
+}
+#endif //ROLLBEAR_STRONG_TYPE_FIXED_STRING_HPP_INCLUDED
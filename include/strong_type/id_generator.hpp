@@ -0,0 +1,163 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_ID_GENERATOR_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_ID_GENERATOR_HPP_INCLUDED
+
+#include "incrementable.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+
+namespace strong
+{
+
+struct globally_monotonic_t {};
+STRONG_INLINE_VARIABLE constexpr globally_monotonic_t globally_monotonic{};
+
+namespace impl
+{
+  inline std::uint64_t next_generator_serial() noexcept
+  {
+    static std::atomic<std::uint64_t> serial{0};
+    return serial.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+}
+
+// Mints unique ids of the incrementable strong type Id from many threads.
+// Each thread reserves a block of ids with a single atomic addition, and
+// mints ids from its block without synchronization, so ids are monotonic
+// per thread, but not between threads. A thread keeps the blocks of the
+// last few generators of Id that it used, and the rest of an evicted block
+// is never minted. With strong::globally_monotonic,
+// every id is reserved individually, which makes them monotonic over all
+// threads at the cost of contention. The constructors are constexpr, so a
+// generator with static storage duration is initialized at compile time.
+template <typename Id>
+class id_generator
+{
+  using T = underlying_type_t<Id>;
+  static_assert(type_is<Id, incrementable>::value,
+                "strong::id_generator<Id> requires strong::incrementable");
+  static_assert(std::is_integral<T>::value,
+                "strong::id_generator<Id> requires an integral underlying type");
+public:
+  using value_type = Id;
+
+  // block_size must be at least 1. A block size of 1 reserves every id on
+  // its own, as strong::globally_monotonic does.
+  constexpr
+  explicit
+  id_generator(
+    const Id& first,
+    T block_size = 1024)
+  : next_(value_of(first))
+  , block_size_(block_size < T{1}
+                ? throw std::invalid_argument("strong::id_generator block size must be at least 1")
+                : block_size)
+  {
+  }
+
+  constexpr
+  id_generator(
+    const Id& first,
+    globally_monotonic_t)
+  noexcept
+  : next_(value_of(first))
+  , block_size_(1)
+  {
+  }
+
+  id_generator(const id_generator&) = delete;
+  id_generator& operator=(const id_generator&) = delete;
+
+  STRONG_NODISCARD
+  Id
+  next()
+  noexcept
+  {
+    if (block_size_ == 1)
+    {
+      return Id{next_.fetch_add(1, std::memory_order_relaxed)};
+    }
+    block& b = thread_block(serial());
+    if (b.next == b.end)
+    {
+      b.next = next_.fetch_add(block_size_, std::memory_order_relaxed);
+      b.end = static_cast<T>(b.next + block_size_);
+    }
+    return Id{b.next++};
+  }
+
+  STRONG_NODISCARD
+  T
+  block_size()
+  const
+  noexcept
+  {
+    return block_size_;
+  }
+private:
+  struct block
+  {
+    std::uint64_t serial;
+    T next;
+    T end;
+  };
+
+  static constexpr unsigned cached_blocks = 4;
+
+  struct block_cache
+  {
+    block blocks[cached_blocks];
+    unsigned evict;
+  };
+
+  // The block of the calling thread for the generator with the serial s,
+  // which is empty if not cached. Misses replace the cached blocks in turn.
+  static block& thread_block(std::uint64_t s) noexcept
+  {
+    static thread_local block_cache cache{};
+    for (auto& b : cache.blocks)
+    {
+      if (b.serial == s) return b;
+    }
+    block& b = cache.blocks[cache.evict++ % cached_blocks];
+    b = block{s, T{}, T{}};
+    return b;
+  }
+
+  // Identifies this generator in the blocks of the threads, assigned on
+  // first use, since the address may be reused by another generator.
+  std::uint64_t serial() noexcept
+  {
+    auto s = serial_.load(std::memory_order_relaxed);
+    if (s == 0)
+    {
+      std::uint64_t expected = 0;
+      const auto assigned = impl::next_generator_serial();
+      s = serial_.compare_exchange_strong(expected, assigned, std::memory_order_relaxed)
+          ? assigned
+          : expected;
+    }
+    return s;
+  }
+
+  std::atomic<T> next_;
+  std::atomic<std::uint64_t> serial_{0};
+  T block_size_;
+};
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_ID_GENERATOR_HPP_INCLUDED
@@ -0,0 +1,104 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_INCREMENTABLE_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_INCREMENTABLE_HPP_INCLUDED
+
+#include "type.hpp"
+
+namespace strong
+{
+
+struct incrementable
+{
+  template <typename T>
+  class modifier
+  {
+  public:
+    STRONG_CONSTEXPR
+    T&
+    operator++()
+    noexcept(noexcept(++std::declval<T&>().value_of()))
+    {
+      auto &self = static_cast<T&>(*this);
+      ++value_of(self);
+      return self;
+    }
+
+    STRONG_CONSTEXPR
+    T
+    operator++(int)
+    noexcept(std::is_nothrow_copy_constructible<T>::value &&
+             noexcept(++std::declval<T&>()))
+    {
+      auto copy = static_cast<T&>(*this);
+      ++*this;
+      return copy;
+    }
+  };
+};
+
+struct decrementable
+{
+  template <typename T>
+  class modifier
+  {
+  public:
+    STRONG_CONSTEXPR
+    T&
+    operator--()
+    noexcept(noexcept(--std::declval<T&>().value_of()))
+    {
+      auto &self = static_cast<T&>(*this);
+      --value_of(self);
+      return self;
+    }
+
+    STRONG_CONSTEXPR
+    T
+    operator--(int)
+    noexcept(std::is_nothrow_copy_constructible<T>::value &&
+             noexcept(--std::declval<T&>()))
+    {
+      auto copy = static_cast<T&>(*this);
+      --*this;
+      return copy;
+    }
+  };
+};
+
+struct bicrementable
+{
+  template <typename>
+  using expands_to = impl::modifier_list<incrementable, decrementable>;
+
+  template <typename T>
+  class modifier
+    : public incrementable::modifier<T>
+    , public decrementable::modifier<T>
+  {
+  };
+};
+
+#if STRONG_HAS_CONCEPTS
+template <typename T>
+concept incrementable_type = type_with<T, incrementable>;
+#endif
+
+#if STRONG_HAS_CONCEPTS
+template <typename T>
+concept decrementable_type = type_with<T, decrementable>;
+#endif
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_INCREMENTABLE_HPP_INCLUDED
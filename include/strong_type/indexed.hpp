@@ -0,0 +1,291 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_INDEXED_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_INDEXED_HPP_INCLUDED
+
+#include "type.hpp"
+
+namespace strong
+{
+
+namespace impl
+{
+  template <typename I, typename = void>
+  struct has_index_bounds : std::false_type {};
+
+  template <typename I>
+  struct has_index_bounds<I, void_t<decltype(I::lower_bound::value), decltype(I::upper_bound::value)>>
+    : std::true_type
+  {
+  };
+
+  // An index I with compile time bounds, like a strong::bounded<> type, that
+  // are always within the compile time size of T, like std::array<>.
+  template <typename I, typename T, typename = void>
+  struct index_always_fits : std::false_type {};
+
+  template <typename I, typename T>
+  struct index_always_fits<I, T, void_t<decltype(I::lower_bound::value), decltype(std::tuple_size<T>::value)>>
+    : std::integral_constant<bool, (I::lower_bound::value >= 0
+                                    && static_cast<std::size_t>(I::upper_bound::value) < std::tuple_size<T>::value)>
+  {
+  };
+
+  template <typename I>
+  STRONG_CONSTEXPR
+  auto
+  index_value(
+    const I& i,
+    std::false_type)
+  noexcept
+  -> decltype(access(i))
+  {
+    return access(i);
+  }
+
+  template <typename I>
+  STRONG_CONSTEXPR
+  auto
+  index_value(
+    const I& i,
+    std::true_type)
+  noexcept
+  -> decltype(access(i))
+  {
+#if !STRONG_CHECKED
+    using V = std::decay_t<decltype(access(i))>;
+    STRONG_ASSUME(static_cast<V>(I::lower_bound::value) <= access(i)
+                  && access(i) <= static_cast<V>(I::upper_bound::value));
+#endif
+    return access(i);
+  }
+
+  // The value of the index i, with its bounds, if it has any, told to the
+  // optimizer in unchecked builds.
+  template <typename I>
+  STRONG_CONSTEXPR
+  auto
+  index_value(
+    const I& i)
+  noexcept
+  -> decltype(access(i))
+  {
+    return index_value(i, has_index_bounds<I>{});
+  }
+
+  template <typename C, typename I>
+  STRONG_CONSTEXPR
+  auto
+  checked_at(
+    C&& c,
+    const I& i,
+    std::false_type)
+  -> decltype(std::forward<C>(c).at(index_value(i)))
+  {
+    return std::forward<C>(c).at(index_value(i));
+  }
+
+  // The range check of at() is redundant for an index that always fits. It
+  // is skipped only in unchecked builds, which trust the bounds of the index.
+  template <typename I, typename T>
+  using skip_index_check = std::integral_constant<bool, !STRONG_CHECKED && index_always_fits<I, T>::value>;
+
+  template <typename C, typename I>
+  STRONG_CONSTEXPR
+  auto
+  checked_at(
+    C&& c,
+    const I& i,
+    std::true_type)
+  noexcept
+  -> decltype(std::forward<C>(c)[index_value(i)])
+  {
+    return std::forward<C>(c)[index_value(i)];
+  }
+}
+
+template <typename I = void>
+struct indexed
+{
+  template <typename T>
+  class modifier;
+};
+
+template <>
+struct indexed<void> {
+  template<typename>
+  class modifier;
+
+  template <typename T, typename Tag, typename ... Ms>
+  class modifier<type<T, Tag, Ms...>> {
+    using ref = T&;
+    using cref = const T&;
+    using rref = T&&;
+    using type = strong::type<T, Tag, Ms...>;
+  public:
+    template<typename I>
+    STRONG_NODISCARD
+    auto
+    operator[](
+      const I &i)
+    const &
+    noexcept(noexcept(std::declval<cref>()[impl::access(i)]))
+    -> decltype(std::declval<cref>()[impl::access(i)]) {
+      auto& self = static_cast<const type&>(*this);
+      return value_of(self)[impl::access(i)];
+    }
+
+    template<typename I>
+    STRONG_NODISCARD
+    auto
+    operator[](
+      const I &i)
+    &
+    noexcept(noexcept(std::declval<ref>()[impl::access(i)]))
+    -> decltype(std::declval<ref>()[impl::access(i)]) {
+      auto& self = static_cast<type&>(*this);
+      return value_of(self)[impl::access(i)];
+    }
+
+    template<typename I>
+    STRONG_NODISCARD
+    auto
+    operator[](
+      const I &i)
+    &&
+    noexcept(noexcept(std::declval<rref>()[impl::access(i)]))
+    -> decltype(std::declval<rref>()[impl::access(i)]) {
+      auto& self = static_cast<type&>(*this);
+      return value_of(std::move(self))[impl::access(i)];
+    }
+
+    template<typename I, typename C = cref>
+    STRONG_NODISCARD
+    auto
+    at(
+      const I &i)
+    const &
+    noexcept(impl::skip_index_check<I, T>::value)
+    -> decltype(std::declval<C>().at(impl::access(i))) {
+      auto& self = static_cast<const type&>(*this);
+      return impl::checked_at(value_of(self), i, impl::skip_index_check<I, T>{});
+    }
+
+    template<typename I, typename R = ref>
+    STRONG_NODISCARD
+    auto
+    at(
+      const I &i)
+    &
+    noexcept(impl::skip_index_check<I, T>::value)
+    -> decltype(std::declval<R>().at(impl::access(i))) {
+      auto& self = static_cast<type&>(*this);
+      return impl::checked_at(value_of(self), i, impl::skip_index_check<I, T>{});
+    }
+
+    template<typename I, typename R = rref>
+    STRONG_NODISCARD
+    auto
+    at(
+      const I &i)
+    &&
+    noexcept(impl::skip_index_check<I, T>::value)
+    -> decltype(std::declval<R>().at(impl::access(i))) {
+      auto& self = static_cast<type&>(*this);
+      return impl::checked_at(value_of(std::move(self)), i, impl::skip_index_check<I, T>{});
+    }
+  };
+};
+
+template <typename I>
+template <typename T, typename Tag, typename ... M>
+class indexed<I>::modifier<type<T, Tag, M...>>
+{
+  using type = ::strong::type<T, Tag, M...>;
+public:
+  STRONG_NODISCARD
+  auto
+  operator[](
+    const I& i)
+  const &
+  noexcept(noexcept(std::declval<const T&>()[impl::index_value(i)]))
+  -> decltype(std::declval<const T&>()[impl::index_value(i)])
+  {
+    auto& self = static_cast<const type&>(*this);
+    return value_of(self)[impl::index_value(i)];
+  }
+
+  STRONG_NODISCARD
+  auto
+  operator[](
+    const I& i)
+  &
+  noexcept(noexcept(std::declval<T&>()[impl::index_value(i)]))
+  -> decltype(std::declval<T&>()[impl::index_value(i)])
+  {
+    auto& self = static_cast<type&>(*this);
+    return value_of(self)[impl::index_value(i)];
+  }
+
+  STRONG_NODISCARD
+  auto
+  operator[](
+    const I& i)
+  &&
+  noexcept(noexcept(std::declval<T&&>()[impl::index_value(i)]))
+  -> decltype(std::declval<T&&>()[impl::index_value(i)])
+  {
+    auto& self = static_cast<type&>(*this);
+    return value_of(std::move(self))[impl::index_value(i)];
+  }
+
+  STRONG_NODISCARD
+  auto
+  at(
+    const I& i)
+  const &
+  noexcept(impl::skip_index_check<I, T>::value)
+  -> decltype(std::declval<const T&>().at(impl::index_value(i)))
+  {
+    auto& self = static_cast<const type&>(*this);
+    return impl::checked_at(value_of(self), i, impl::skip_index_check<I, T>{});
+  }
+
+  STRONG_NODISCARD
+  auto
+  at(
+    const I& i)
+  &
+  noexcept(impl::skip_index_check<I, T>::value)
+  -> decltype(std::declval<T&>().at(impl::index_value(i)))
+  {
+    auto& self = static_cast<type&>(*this);
+    return impl::checked_at(value_of(self), i, impl::skip_index_check<I, T>{});
+  }
+
+  STRONG_NODISCARD
+  auto
+  at(
+    const I& i)
+  &&
+  noexcept(impl::skip_index_check<I, T>::value)
+  -> decltype(std::declval<T&&>().at(impl::index_value(i)))
+  {
+    auto& self = static_cast<type&>(*this);
+    return impl::checked_at(value_of(std::move(self)), i, impl::skip_index_check<I, T>{});
+  }
+};
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_INDEXED_HPP_INCLUDED
@@ -0,0 +1,447 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_INTERNED_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_INTERNED_HPP_INCLUDED
+
+#include "cache_aligned.hpp"
+#include "equality.hpp"
+#include "hashable.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace strong
+{
+
+namespace impl
+{
+  struct interned_entry
+  {
+    const char* text;
+    std::uint32_t size;
+    std::uint32_t code;
+  };
+
+  struct interned_key
+  {
+    const char* text;
+    std::size_t size;
+    std::size_t hash;
+
+    friend bool operator==(const interned_key& lh, const interned_key& rh) noexcept
+    {
+      return lh.size == rh.size && std::memcmp(lh.text, rh.text, lh.size) == 0;
+    }
+  };
+
+  struct interned_key_hash
+  {
+    std::size_t operator()(const interned_key& k) const noexcept { return k.hash; }
+  };
+
+  inline std::size_t hash_text(const char* s, std::size_t n) noexcept
+  {
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+      h ^= static_cast<unsigned char>(s[i]);
+      h *= 0x100000001b3ULL;
+    }
+    return static_cast<std::size_t>(h ^ (h >> 32));
+  }
+
+  inline unsigned floor_log2(std::uint64_t v) noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63U - static_cast<unsigned>(__builtin_clzll(v));
+#else
+    unsigned r = 0;
+    while (v >>= 1) ++r;
+    return r;
+#endif
+  }
+
+  // Bump allocation from large chunks, which are only released with the
+  // arena.
+  class interned_arena
+  {
+  public:
+    void* allocate(std::size_t size, std::size_t align)
+    {
+      std::size_t skip = (align - reinterpret_cast<std::uintptr_t>(next_) % align) % align;
+      if (skip + size > left_)
+      {
+        std::size_t chunk = chunk_size;
+        if (size + align > chunk) chunk = size + align;
+        chunks_.emplace_back(new char[chunk]);
+        next_ = chunks_.back().get();
+        left_ = chunk;
+        skip = (align - reinterpret_cast<std::uintptr_t>(next_) % align) % align;
+      }
+      void* p = next_ + skip;
+      next_ += skip + size;
+      left_ -= skip + size;
+      return p;
+    }
+  private:
+    static constexpr std::size_t chunk_size = 64 * 1024;
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    char* next_ = nullptr;
+    std::size_t left_ = 0;
+  };
+
+  // The strings interned for one tag. Lookup and insertion lock one of
+  // several shards, chosen by the hash of the text, so threads interning
+  // different strings rarely contend. Every new string gets the next dense
+  // code, starting at 1, under a short lock of the directory from codes to
+  // entries, which publishes the codes in order and is read without locks.
+  // Code 0 is the empty string, which has no entry.
+  class intern_pool
+  {
+  public:
+    intern_pool() = default;
+    intern_pool(const intern_pool&) = delete;
+    intern_pool& operator=(const intern_pool&) = delete;
+
+    ~intern_pool()
+    {
+      for (auto& segment : segments_)
+      {
+        delete[] segment.load(std::memory_order_relaxed);
+      }
+    }
+
+    const interned_entry* intern(const char* text, std::size_t size)
+    {
+      if (size == 0) return nullptr;
+      if (static_cast<std::uint64_t>(size) > UINT32_MAX) throw std::length_error("strong::interned string too long");
+      const interned_key key{text, size, hash_text(text, size)};
+      shard& s = shards_[(key.hash >> 7) % shard_count];
+      std::lock_guard<std::mutex> lock(s.mutex);
+      auto i = s.entries.find(key);
+      if (i != s.entries.end()) return i->second;
+
+      char* copy = static_cast<char*>(s.arena.allocate(size + 1, 1));
+      std::memcpy(copy, text, size);
+      copy[size] = '\0';
+      auto entry = new (s.arena.allocate(sizeof(interned_entry), alignof(interned_entry)))
+        interned_entry{copy, static_cast<std::uint32_t>(size), 0U};
+      i = s.entries.emplace(interned_key{copy, size, key.hash}, entry).first;
+      try
+      {
+        publish(*entry);
+      }
+      catch (...)
+      {
+        s.entries.erase(i);
+        throw;
+      }
+      return entry;
+    }
+
+    // The entry with the code, or nullptr if no entry has the code yet.
+    const interned_entry* decode(std::uint32_t code) const noexcept
+    {
+      if (code == 0) return nullptr;
+      const auto p = segments_[segment_of(code)].load(std::memory_order_acquire);
+      return p ? p[offset_of(code)].load(std::memory_order_acquire) : nullptr;
+    }
+
+    // All codes less than this are published, and decode() finds them.
+    std::uint32_t code_count() const noexcept
+    {
+      return code_count_.load(std::memory_order_acquire);
+    }
+  private:
+    using directory_slot = std::atomic<const interned_entry*>;
+
+    static constexpr std::size_t shard_count = 16;
+    static constexpr std::uint64_t first_segment = 256;
+
+    // Segment n has room for first_segment << n entries, so the directory
+    // grows without moving entries that readers may be looking at.
+    static unsigned segment_of(std::uint32_t code) noexcept
+    {
+      return floor_log2((code - 1U) / first_segment + 1);
+    }
+
+    static std::uint64_t offset_of(std::uint32_t code) noexcept
+    {
+      return code - 1U - first_segment * ((std::uint64_t{1} << segment_of(code)) - 1);
+    }
+
+    // Gives the entry the next code, and stores it in the directory before
+    // the code count includes it. Nothing changes if this throws.
+    void publish(interned_entry& entry)
+    {
+      std::lock_guard<std::mutex> lock(directory_mutex_);
+      const auto code = code_count_.load(std::memory_order_relaxed);
+      if (code == UINT32_MAX) throw std::length_error("strong::interned codes exhausted");
+      auto& segment = segments_[segment_of(code)];
+      auto p = segment.load(std::memory_order_relaxed);
+      if (!p)
+      {
+        p = new directory_slot[first_segment << segment_of(code)]();
+        segment.store(p, std::memory_order_release);
+      }
+      entry.code = code;
+      p[offset_of(code)].store(&entry, std::memory_order_release);
+      code_count_.store(code + 1U, std::memory_order_release);
+    }
+
+    struct alignas(STRONG_CACHE_LINE_SIZE) shard
+    {
+      std::mutex mutex;
+      std::unordered_map<interned_key, const interned_entry*, interned_key_hash> entries;
+      interned_arena arena;
+    };
+
+    shard shards_[shard_count];
+    std::mutex directory_mutex_;
+    std::atomic<std::uint32_t> code_count_{1};
+    std::atomic<directory_slot*> segments_[32] = {};
+  };
+}
+
+// An underlying type for strong::type that refers to text interned in a pool
+// of its own for each Tag. It is the size of a pointer and trivially
+// copyable, and equal strings are the same pointer, so comparisons and
+// hashing never look at the text. The pool keeps the text for the lifetime
+// of the program. A default constructed interned_string is the empty string.
+// Every interned string has a dense code, from 1 up, and 0 for the empty
+// string, for dictionary encoding.
+template <typename Tag>
+class interned_string
+{
+public:
+  constexpr interned_string() noexcept = default;
+
+  interned_string(
+    const char* text,
+    std::size_t size)
+  : entry_(pool().intern(text, size))
+  {
+  }
+
+  explicit
+  interned_string(
+    const char* text)
+  : interned_string(text, std::strlen(text))
+  {
+  }
+
+  explicit
+  interned_string(
+    const std::string& text)
+  : interned_string(text.data(), text.size())
+  {
+  }
+
+#if __cplusplus >= 201703L
+  explicit
+  interned_string(
+    std::string_view text)
+  : interned_string(text.data(), text.size())
+  {
+  }
+
+  STRONG_NODISCARD
+  std::string_view
+  view()
+  const
+  noexcept
+  {
+    return std::string_view(c_str(), size());
+  }
+#endif
+
+  STRONG_NODISCARD
+  const char*
+  c_str()
+  const
+  noexcept
+  {
+    return entry_ ? entry_->text : "";
+  }
+
+  STRONG_NODISCARD
+  std::size_t
+  size()
+  const
+  noexcept
+  {
+    return entry_ ? entry_->size : 0U;
+  }
+
+  STRONG_NODISCARD
+  bool
+  empty()
+  const
+  noexcept
+  {
+    return entry_ == nullptr;
+  }
+
+  STRONG_NODISCARD
+  std::string
+  str()
+  const
+  {
+    return std::string(c_str(), size());
+  }
+
+  STRONG_NODISCARD
+  std::uint32_t
+  code()
+  const
+  noexcept
+  {
+    return entry_ ? entry_->code : 0U;
+  }
+
+  // The interned string with the code, or the empty string if no string
+  // has the code yet.
+  STRONG_NODISCARD
+  static
+  interned_string
+  from_code(
+    std::uint32_t code)
+  noexcept
+  {
+    interned_string s;
+    s.entry_ = pool().decode(code);
+    return s;
+  }
+
+  // The strings with all codes less than this can be found by from_code().
+  STRONG_NODISCARD
+  static
+  std::uint32_t
+  code_count()
+  noexcept
+  {
+    return pool().code_count();
+  }
+
+  STRONG_NODISCARD
+  friend
+  constexpr
+  bool
+  operator==(
+    const interned_string& lh,
+    const interned_string& rh)
+  noexcept
+  {
+    return lh.entry_ == rh.entry_;
+  }
+
+  STRONG_NODISCARD
+  friend
+  constexpr
+  bool
+  operator!=(
+    const interned_string& lh,
+    const interned_string& rh)
+  noexcept
+  {
+    return !(lh == rh);
+  }
+
+  template <typename Traits>
+  friend
+  std::basic_ostream<char, Traits>&
+  operator<<(
+    std::basic_ostream<char, Traits>& os,
+    const interned_string& s)
+  {
+    return os.write(s.c_str(), static_cast<decltype(os.width())>(s.size()));
+  }
+private:
+  friend struct std::hash<interned_string>;
+
+  static impl::intern_pool& pool()
+  {
+    static impl::intern_pool p;
+    return p;
+  }
+
+  const impl::interned_entry* entry_ = nullptr;
+};
+
+template <typename Tag, typename ... M>
+using interned = type<interned_string<Tag>, Tag, default_constructible, equality, hashable, M...>;
+
+// Writes the dense codes of count interned strong values to codes, for
+// columnar storage.
+template <typename S>
+void
+encode_interned(
+  const S* first,
+  std::size_t count,
+  std::uint32_t* codes)
+noexcept
+{
+  for (std::size_t i = 0; i != count; ++i)
+  {
+    codes[i] = value_of(first[i]).code();
+  }
+}
+
+// Assigns the interned strong values with the count codes, as written by
+// encode_interned(), to the already existing objects pointed to by out.
+template <typename S>
+void
+decode_interned(
+  const std::uint32_t* codes,
+  std::size_t count,
+  S* out)
+noexcept
+{
+  using T = underlying_type_t<S>;
+  for (std::size_t i = 0; i != count; ++i)
+  {
+    value_of(out[i]) = T::from_code(codes[i]);
+  }
+}
+
+}
+
+namespace std {
+template <typename Tag>
+struct hash<::strong::interned_string<Tag>>
+{
+  size_t
+  operator()(
+    const ::strong::interned_string<Tag>& s)
+  const
+  noexcept
+  {
+    return hash<const void*>{}(s.entry_);
+  }
+};
+}
+#endif //ROLLBEAR_STRONG_TYPE_INTERNED_HPP_INCLUDED
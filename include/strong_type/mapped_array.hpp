@@ -0,0 +1,357 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_MAPPED_ARRAY_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_MAPPED_ARRAY_HPP_INCLUDED
+
+#include "indexed.hpp"
+#include "range.hpp"
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "strong::mapped_array requires a POSIX system with mmap()"
+#endif
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace strong
+{
+
+namespace impl
+{
+  template <typename ... Ts>
+  const char* type_signature() noexcept
+  {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+  }
+
+  inline std::uint64_t fnv1a(const char* s) noexcept
+  {
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    while (*s)
+    {
+      h ^= static_cast<unsigned char>(*s++);
+      h *= 0x100000001b3ULL;
+    }
+    return h;
+  }
+
+  template <typename T, typename Tag, typename ... Ms>
+  constexpr Tag tag_type(strong::type<T, Tag, Ms...>*);
+
+  template <typename E>
+  class array_view
+  {
+  public:
+    constexpr array_view(E* first, std::size_t count) noexcept
+      : first_(first), count_(count) {}
+    constexpr E* begin() const noexcept { return first_; }
+    constexpr E* end() const noexcept { return first_ + count_; }
+    constexpr E* data() const noexcept { return first_; }
+    constexpr std::size_t size() const noexcept { return count_; }
+    constexpr E& operator[](std::size_t i) const noexcept { return first_[i]; }
+    E& at(std::size_t i) const
+    {
+      if (i >= count_) throw std::out_of_range("strong::mapped_array index out of range");
+      return first_[i];
+    }
+  private:
+    E* first_;
+    std::size_t count_;
+  };
+}
+
+// Identifies the strong type S in the header of a mapped array file. The
+// default is a hash of the compiler's spelling of the tag and underlying type
+// of S, which is stable for a program built with the same compiler family.
+// Specialize it for files that must be shared between compilers.
+template <typename S>
+struct identity_hash
+{
+  static std::uint64_t value() noexcept
+  {
+    using tag = decltype(impl::tag_type(static_cast<S*>(nullptr)));
+    return impl::fnv1a(impl::type_signature<tag, underlying_type_t<S>>());
+  }
+};
+
+class mapped_array_error : public std::runtime_error
+{
+public:
+  using std::runtime_error::runtime_error;
+};
+
+namespace impl
+{
+  // The file starts with a 64 byte header, followed by the elements. All
+  // header fields are in the byte order of the writer, which is recognized
+  // by the byte order mark.
+  struct mapped_array_header
+  {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order_mark;
+    std::uint64_t identity;
+    std::uint64_t element_size;
+    std::uint64_t count;
+    unsigned char reserved[24];
+  };
+  static_assert(sizeof(mapped_array_header) == 64, "");
+
+  static constexpr char mapped_array_magic[8] = { 's','t','r','o','n','g','m','a' };
+  static constexpr std::uint32_t mapped_array_version = 1;
+  static constexpr std::uint32_t mapped_array_bom = 0x01020304;
+  static constexpr std::uint32_t mapped_array_swapped_bom = 0x04030201;
+
+  template <typename S>
+  void require_mapped_array_element()
+  {
+    static_assert(is_strong_type<S>::value, "element type must be a strong type");
+    static_assert(std::is_trivially_copyable<S>::value,
+                  "element type must be trivially copyable");
+    static_assert(alignof(S) <= sizeof(mapped_array_header),
+                  "element type is over aligned");
+  }
+
+  [[noreturn]] inline void throw_errno(const std::string& what)
+  {
+    throw std::system_error(errno, std::generic_category(), what);
+  }
+}
+
+// Writes count elements to the file at path, in the format read by
+// strong::mapped_array<S>.
+template <typename S>
+void
+write_mapped_array(
+  const std::string& path,
+  const S* first,
+  std::size_t count)
+{
+  impl::require_mapped_array_element<S>();
+  impl::mapped_array_header header{};
+  std::memcpy(header.magic, impl::mapped_array_magic, sizeof(header.magic));
+  header.version = impl::mapped_array_version;
+  header.byte_order_mark = impl::mapped_array_bom;
+  header.identity = identity_hash<S>::value();
+  header.element_size = sizeof(S);
+  header.count = count;
+
+  std::FILE* f = std::fopen(path.c_str(), "wb");
+  if (!f) impl::throw_errno(path);
+  bool ok = std::fwrite(&header, sizeof(header), 1, f) == 1
+            && std::fwrite(first, sizeof(S), count, f) == count;
+  ok = (std::fclose(f) == 0) && ok;
+  if (!ok) impl::throw_errno(path);
+}
+
+enum class map_mode
+{
+  read_only,
+  copy_on_write
+};
+
+template <typename S>
+class mapped_array
+{
+public:
+  using view_type = ::strong::type<impl::array_view<const S>, S, range, indexed<>>;
+  using mutable_view_type = ::strong::type<impl::array_view<S>, S, range, indexed<>>;
+
+  explicit
+  mapped_array(
+    const std::string& path,
+    map_mode mode = map_mode::read_only)
+  : mode_(mode)
+  {
+    impl::require_mapped_array_element<S>();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) impl::throw_errno(path);
+    struct stat st;
+    if (::fstat(fd, &st) == -1)
+    {
+      auto e = errno;
+      ::close(fd);
+      errno = e;
+      impl::throw_errno(path);
+    }
+    size_ = static_cast<std::size_t>(st.st_size);
+    if (size_ < sizeof(impl::mapped_array_header))
+    {
+      ::close(fd);
+      throw mapped_array_error(path + ": not a strong::mapped_array file");
+    }
+    const int prot = mode == map_mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE;
+    const int flags = mode == map_mode::read_only ? MAP_SHARED : MAP_PRIVATE;
+    map_ = ::mmap(nullptr, size_, prot, flags, fd, 0);
+    auto e = errno;
+    ::close(fd);
+    if (map_ == MAP_FAILED)
+    {
+      map_ = nullptr;
+      errno = e;
+      impl::throw_errno(path);
+    }
+    try
+    {
+      validate(path);
+    }
+    catch (...)
+    {
+      ::munmap(map_, size_);
+      throw;
+    }
+  }
+
+  mapped_array(const mapped_array&) = delete;
+  mapped_array& operator=(const mapped_array&) = delete;
+
+  mapped_array(mapped_array&& other) noexcept
+  : map_(other.map_)
+  , size_(other.size_)
+  , count_(other.count_)
+  , mode_(other.mode_)
+  {
+    other.map_ = nullptr;
+  }
+
+  mapped_array& operator=(mapped_array&& other) noexcept
+  {
+    std::swap(map_, other.map_);
+    std::swap(size_, other.size_);
+    std::swap(count_, other.count_);
+    std::swap(mode_, other.mode_);
+    return *this;
+  }
+
+  ~mapped_array()
+  {
+    if (map_) ::munmap(map_, size_);
+  }
+
+  STRONG_NODISCARD
+  const S*
+  data()
+  const
+  noexcept
+  {
+    return reinterpret_cast<const S*>(static_cast<const char*>(map_) + sizeof(impl::mapped_array_header));
+  }
+
+  STRONG_NODISCARD
+  std::size_t
+  size()
+  const
+  noexcept
+  {
+    return count_;
+  }
+
+  STRONG_NODISCARD
+  map_mode
+  mode()
+  const
+  noexcept
+  {
+    return mode_;
+  }
+
+  const S* begin() const noexcept { return data(); }
+  const S* end() const noexcept { return data() + count_; }
+
+  STRONG_NODISCARD
+  const S&
+  operator[](
+    std::size_t i)
+  const
+  noexcept
+  {
+    return data()[i];
+  }
+
+  STRONG_NODISCARD
+  view_type
+  view()
+  const
+  noexcept
+  {
+    return view_type(data(), count_);
+  }
+
+  // Only in map_mode::copy_on_write. Changes are private to this mapping and
+  // never written back to the file.
+  STRONG_NODISCARD
+  mutable_view_type
+  mutable_view()
+  {
+    if (mode_ != map_mode::copy_on_write)
+    {
+      throw std::logic_error("strong::mapped_array is not mapped copy on write");
+    }
+    return mutable_view_type(const_cast<S*>(data()), count_);
+  }
+private:
+  void validate(const std::string& path)
+  {
+    impl::mapped_array_header header;
+    std::memcpy(&header, map_, sizeof(header));
+    // The byte order mark is checked before any other field, since the
+    // fields of a file from a writer with the other byte order all read
+    // as byte swapped values.
+    if (std::memcmp(header.magic, impl::mapped_array_magic, sizeof(header.magic)) != 0)
+    {
+      throw mapped_array_error(path + ": not a strong::mapped_array file");
+    }
+    if (header.byte_order_mark == impl::mapped_array_swapped_bom)
+    {
+      throw mapped_array_error(path + ": written with a different byte order");
+    }
+    if (header.byte_order_mark != impl::mapped_array_bom
+        || header.version != impl::mapped_array_version)
+    {
+      throw mapped_array_error(path + ": not a strong::mapped_array file");
+    }
+    if (header.identity != identity_hash<S>::value()
+        || header.element_size != sizeof(S))
+    {
+      throw mapped_array_error(path + ": written for a different strong type");
+    }
+    if (header.count > (size_ - sizeof(header)) / sizeof(S))
+    {
+      throw mapped_array_error(path + ": truncated");
+    }
+    count_ = static_cast<std::size_t>(header.count);
+  }
+
+  void* map_ = nullptr;
+  std::size_t size_ = 0;
+  std::size_t count_ = 0;
+  map_mode mode_;
+};
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_MAPPED_ARRAY_HPP_INCLUDED
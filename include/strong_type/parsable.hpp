@@ -0,0 +1,104 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_PARSABLE_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_PARSABLE_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if defined(__has_include)
+#if __cplusplus >= 201703L && __has_include(<charconv>)
+#define STRONG_HAS_CHARCONV 1
+#endif
+#endif
+#ifndef STRONG_HAS_CHARCONV
+#define STRONG_HAS_CHARCONV 0
+#endif
+
+#if STRONG_HAS_CHARCONV
+#include <charconv>
+#include <string_view>
+#include <system_error>
+#endif
+
+#if STRONG_HAS_CHARCONV
+namespace strong
+{
+
+struct parsable
+{
+  template <typename T>
+  class modifier;
+};
+
+template <typename T, typename Tag, typename ... M>
+class parsable::modifier<::strong::type<T, Tag, M...>>
+{
+  using type = ::strong::type<T, Tag, M...>;
+public:
+  template <typename ... A>
+  friend
+  auto
+  from_chars(
+    const char* first,
+    const char* last,
+    type& t,
+    A ... a)
+  noexcept
+  -> decltype(std::from_chars(first, last, std::declval<T&>(), a...))
+  {
+    return std::from_chars(first, last, value_of(t), a...);
+  }
+};
+
+template <typename O>
+struct parse_result
+{
+  O out;
+  const char* ptr;
+  std::errc ec;
+};
+
+// Parses every field of text, separated by delimiter, into an instance of
+// the parsable strong type S written to out. A delimiter at the very end of
+// text is accepted. On failure, ptr points to where parsing stopped and ec
+// tells why, while out has received every field before the offending one.
+template <typename S, typename O>
+STRONG_NODISCARD
+parse_result<O>
+parse_delimited(
+  std::string_view text,
+  char delimiter,
+  O out)
+{
+  using T = underlying_type_t<S>;
+  const char* const begin = text.data();
+  std::size_t pos = 0;
+  while (pos < text.size())
+  {
+    auto next = text.find(delimiter, pos);
+    if (next == std::string_view::npos) next = text.size();
+    S s{T{}};
+    auto r = from_chars(begin + pos, begin + next, s);
+    if (r.ec != std::errc{}) return {out, r.ptr, r.ec};
+    if (r.ptr != begin + next) return {out, r.ptr, std::errc::invalid_argument};
+    *out = std::move(s);
+    ++out;
+    pos = next + 1;
+  }
+  return {out, begin + text.size(), std::errc{}};
+}
+
+}
+#endif
+#endif //ROLLBEAR_STRONG_TYPE_PARSABLE_HPP_INCLUDED
@@ -0,0 +1,214 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_PER_THREAD_ARRAY_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_PER_THREAD_ARRAY_HPP_INCLUDED
+
+#include "cache_aligned.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace strong
+{
+
+namespace impl
+{
+  // The small numbers in use by live threads. A thread gets the smallest
+  // number not in use, and gives it back when it exits.
+  class thread_index_registry
+  {
+  public:
+    static thread_index_registry& instance()
+    {
+      static thread_index_registry registry;
+      return registry;
+    }
+
+    std::size_t acquire()
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto i = std::find(used_.begin(), used_.end(), false);
+      if (i == used_.end())
+      {
+        used_.push_back(true);
+        return used_.size() - 1;
+      }
+      *i = true;
+      return static_cast<std::size_t>(i - used_.begin());
+    }
+
+    void release(std::size_t index) noexcept
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      used_[index] = false;
+    }
+  private:
+    std::mutex mutex_;
+    std::vector<bool> used_;
+  };
+
+  // A small number unique to the calling thread among the live threads,
+  // reused after the thread exits. The first call in a thread registers it,
+  // which may throw.
+  inline std::size_t thread_index()
+  {
+    struct holder
+    {
+      holder() : index(thread_index_registry::instance().acquire()) {}
+      ~holder() { thread_index_registry::instance().release(index); }
+      std::size_t index;
+    };
+    thread_local holder h;
+    return h.index;
+  }
+}
+
+// A fixed number of values of type S, each in a cache line of its own, so
+// that threads that each update their own element do not contend. Every
+// live thread that has used a per_thread_array has an index of its own, and
+// local() is the element of that index, modulo the number of elements. With
+// no more such threads than elements, no two threads share an element.
+// Otherwise they do, and S must then be safe to update concurrently, like
+// strong::atomic<>.
+template <typename S>
+class per_thread_array
+{
+  struct slot : cache_aligned::modifier<slot>
+  {
+    template <typename V>
+    explicit slot(const V& v) : value(v) {}
+    S value;
+  };
+public:
+  using value_type = S;
+
+  // The number of hardware threads.
+  STRONG_NODISCARD
+  static
+  std::size_t
+  default_size()
+  noexcept
+  {
+    return std::max(1U, std::thread::hardware_concurrency());
+  }
+
+  // count elements, each constructed from init. count must not be 0.
+  template <typename V>
+  explicit
+  per_thread_array(
+    const V& init,
+    std::size_t count = default_size())
+  : count_(count)
+  {
+    if (count == 0) throw std::invalid_argument("strong::per_thread_array requires at least one element");
+    std::size_t space = count * sizeof(slot) + alignof(slot);
+    raw_ = ::operator new(space);
+    void* p = raw_;
+    slots_ = static_cast<slot*>(std::align(alignof(slot), count * sizeof(slot), p, space));
+    std::size_t i = 0;
+    try
+    {
+      for (; i != count; ++i)
+      {
+        ::new (static_cast<void*>(slots_ + i)) slot(init);
+      }
+    }
+    catch (...)
+    {
+      destroy(i);
+      throw;
+    }
+  }
+
+  per_thread_array(const per_thread_array&) = delete;
+  per_thread_array& operator=(const per_thread_array&) = delete;
+
+  ~per_thread_array()
+  {
+    destroy(count_);
+  }
+
+  STRONG_NODISCARD
+  std::size_t
+  size()
+  const
+  noexcept
+  {
+    return count_;
+  }
+
+  STRONG_NODISCARD
+  S&
+  operator[](
+    std::size_t i)
+  noexcept
+  {
+    return slots_[i].value;
+  }
+
+  STRONG_NODISCARD
+  const S&
+  operator[](
+    std::size_t i)
+  const
+  noexcept
+  {
+    return slots_[i].value;
+  }
+
+  // The element for the calling thread. Threads share elements if there are
+  // more live threads than elements. The first call in a thread may throw
+  // std::bad_alloc or std::system_error when registering the thread.
+  STRONG_NODISCARD
+  S&
+  local()
+  {
+    return (*this)[impl::thread_index() % count_];
+  }
+
+  template <typename F>
+  void
+  for_each(
+    F f)
+  {
+    for (std::size_t i = 0; i != count_; ++i) f(slots_[i].value);
+  }
+
+  template <typename F>
+  void
+  for_each(
+    F f)
+  const
+  {
+    for (std::size_t i = 0; i != count_; ++i) f(static_cast<const S&>(slots_[i].value));
+  }
+private:
+  void destroy(std::size_t n) noexcept
+  {
+    while (n) slots_[--n].~slot();
+    ::operator delete(raw_);
+  }
+
+  std::size_t count_;
+  void* raw_;
+  slot* slots_;
+};
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_PER_THREAD_ARRAY_HPP_INCLUDED
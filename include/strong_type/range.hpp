@@ -0,0 +1,181 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_RANGE_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_RANGE_HPP_INCLUDED
+
+#include "affine_point.hpp"
+#include "equality.hpp"
+#include "incrementable.hpp"
+#include "indexed.hpp"
+#include "ordered.hpp"
+#include "pointer.hpp"
+
+#include <iterator>
+
+namespace strong
+{
+
+namespace impl
+{
+  struct iterator_types
+  {
+    template <typename I>
+    class modifier
+    {
+    public:
+      using difference_type = typename std::iterator_traits<underlying_type_t<I>>::difference_type;
+      using value_type = typename std::iterator_traits<underlying_type_t<I>>::value_type;
+      using pointer = typename std::iterator_traits<underlying_type_t<I>>::value_type;
+      using reference = typename std::iterator_traits<underlying_type_t<I>>::reference;
+      using iterator_category = typename std::iterator_traits<underlying_type_t<I>>::iterator_category;
+    };
+  };
+
+  template <typename T, typename category = typename std::iterator_traits<T>::iterator_category>
+  struct iterator_modifiers
+  {
+    using type = modifier_list<iterator_types, pointer, equality, incrementable>;
+  };
+
+  template <typename T>
+  struct iterator_modifiers<T, std::bidirectional_iterator_tag>
+  {
+    using type = modifier_list<iterator_types, pointer, equality, bicrementable>;
+  };
+
+  template <typename T>
+  struct iterator_modifiers<T, std::random_access_iterator_tag>
+  {
+    using type = modifier_list<
+      iterator_types, pointer, equality, bicrementable,
+      affine_point<typename std::iterator_traits<T>::difference_type>,
+      indexed<>,
+      ordered>;
+  };
+}
+
+class iterator
+{
+public:
+  template <typename T>
+  using expands_to = typename impl::iterator_modifiers<T>::type;
+
+  template <typename I, typename category = typename std::iterator_traits<underlying_type_t<I>>::iterator_category>
+  class modifier
+    : public impl::iterator_types::modifier<I>
+    , public pointer::modifier<I>
+    , public equality::modifier<I>
+    , public incrementable::modifier<I>
+  {
+  };
+
+  template <typename I>
+  class modifier<I, std::bidirectional_iterator_tag>
+    : public modifier<I, std::forward_iterator_tag>
+      , public decrementable::modifier<I>
+  {
+  };
+  template <typename I>
+  class modifier<I, std::random_access_iterator_tag>
+    : public modifier<I, std::bidirectional_iterator_tag>
+      , public affine_point<typename std::iterator_traits<underlying_type_t<I>>::difference_type>::template modifier<I>
+      , public indexed<>::modifier<I>
+      , public ordered::modifier<I>
+  {
+  };
+};
+
+class range
+{
+public:
+  template <typename R>
+  class modifier;
+};
+
+template <typename T, typename Tag, typename ... M>
+class range::modifier<type<T, Tag, M...>>
+{
+  using type = ::strong::type<T, Tag, M...>;
+  using r_iterator = decltype(std::declval<T&>().begin());
+  using r_const_iterator = decltype(std::declval<const T&>().begin());
+public:
+  using iterator = ::strong::type<r_iterator, Tag, strong::iterator>;
+  using const_iterator = ::strong::type<r_const_iterator, Tag, strong::iterator>;
+
+  STRONG_CONSTEXPR
+  iterator
+  begin()
+  noexcept(noexcept(std::declval<T&>().begin()))
+  {
+    auto& self = static_cast<type&>(*this);
+    return iterator{value_of(self).begin()};
+  }
+
+  STRONG_CONSTEXPR
+  iterator
+  end()
+  noexcept(noexcept(std::declval<T&>().end()))
+  {
+    auto& self = static_cast<type&>(*this);
+    return iterator{value_of(self).end()};
+  }
+
+  STRONG_CONSTEXPR
+  const_iterator
+  cbegin()
+    const
+  noexcept(noexcept(std::declval<const T&>().begin()))
+  {
+    auto& self = static_cast<const type&>(*this);
+    return const_iterator{value_of(self).begin()};
+  }
+
+  STRONG_CONSTEXPR
+  const_iterator
+  cend()
+    const
+  noexcept(noexcept(std::declval<const T&>().end()))
+  {
+    auto& self = static_cast<const type&>(*this);
+    return const_iterator{value_of(self).end()};
+  }
+
+  STRONG_CONSTEXPR
+  const_iterator
+  begin()
+  const
+  noexcept(noexcept(std::declval<const T&>().begin()))
+  {
+    auto& self = static_cast<const type&>(*this);
+    return const_iterator{value_of(self).begin()};
+  }
+
+  STRONG_CONSTEXPR
+  const_iterator
+  end()
+  const
+  noexcept(noexcept(std::declval<const T&>().end()))
+  {
+    auto& self = static_cast<const type&>(*this);
+    return const_iterator{value_of(self).end()};
+  }
+};
+
+#if STRONG_HAS_CONCEPTS
+template <typename T>
+concept range_type = type_with<T, range>;
+#endif
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_RANGE_HPP_INCLUDED
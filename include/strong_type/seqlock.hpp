@@ -0,0 +1,199 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_SEQLOCK_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_SEQLOCK_HPP_INCLUDED
+
+#include "cache_aligned.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+
+namespace strong
+{
+
+namespace impl
+{
+  template <typename ... S>
+  constexpr std::size_t field_offset(std::size_t index)
+  {
+    const std::size_t sizes[] = { sizeof(S)... };
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i != index; ++i) offset += sizes[i];
+    return offset;
+  }
+
+  // An S to copy bytes into, left uninitialized when the underlying type
+  // allows it.
+  template <typename S>
+  S blank(std::true_type) noexcept
+  {
+    return S(uninitialized);
+  }
+
+  template <typename S>
+  S blank(std::false_type) noexcept
+  {
+    return S{};
+  }
+
+  template <typename S>
+  using can_be_blank = std::integral_constant<bool,
+    std::is_trivially_default_constructible<underlying_type_t<S>>::value
+    || std::is_nothrow_default_constructible<S>::value>;
+
+  template <typename S>
+  S from_bytes(const unsigned char* p) noexcept
+  {
+    S s = blank<S>(std::is_trivially_default_constructible<underlying_type_t<S>>{});
+    std::memcpy(&s, p, sizeof(S));
+    return s;
+  }
+
+  template <typename ... S>
+  struct seqlock_value
+  {
+    using type = std::tuple<S...>;
+  };
+
+  template <typename S>
+  struct seqlock_value<S>
+  {
+    using type = S;
+  };
+}
+
+// One or more trivially copyable strong values, published by a single writer
+// to any number of readers. Readers never block the writer or each other, but
+// retry if the writer changed the values while they were read. With one
+// strong type, load() returns it, with several, load() returns a std::tuple.
+template <typename ... S>
+class seqlock : private cache_aligned::modifier<seqlock<S...>>
+{
+  static_assert(sizeof...(S) > 0, "strong::seqlock requires at least one strong type");
+  static_assert(impl::all_of<is_strong_type<S>::value...>::value,
+                "strong::seqlock requires strong types");
+  static_assert(impl::all_of<std::is_trivially_copyable<S>::value...>::value,
+                "strong::seqlock requires trivially copyable strong types");
+  static_assert(impl::all_of<impl::can_be_blank<S>::value...>::value,
+                "strong::seqlock requires strong types with a trivially default constructible underlying type, or that are nothrow default constructible");
+
+  using word = std::uintptr_t;
+  static constexpr std::size_t bytes = impl::field_offset<S...>(sizeof...(S));
+  static constexpr std::size_t words = (bytes + sizeof(word) - 1) / sizeof(word);
+public:
+  using value_type = typename impl::seqlock_value<S...>::type;
+
+  explicit
+  seqlock(
+    const S& ... s)
+  noexcept
+  {
+    store(s...);
+  }
+
+  seqlock(const seqlock&) = delete;
+  seqlock& operator=(const seqlock&) = delete;
+
+  // Only one thread at a time may store.
+  void
+  store(
+    const S& ... s)
+  noexcept
+  {
+    word buffer[words] = {};
+    store_fields(reinterpret_cast<unsigned char*>(buffer), std::index_sequence_for<S...>{}, s...);
+    const auto seq = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (std::size_t i = 0; i != words; ++i)
+    {
+      data_[i].store(buffer[i], std::memory_order_relaxed);
+    }
+    sequence_.store(seq + 2, std::memory_order_release);
+  }
+
+  // A single attempt, that returns false without changing out if the values
+  // were being stored.
+  bool
+  try_load(
+    value_type& out)
+  const
+  noexcept
+  {
+    word buffer[words];
+    const auto seq = sequence_.load(std::memory_order_acquire);
+    if (seq & 1U) return false;
+    for (std::size_t i = 0; i != words; ++i)
+    {
+      buffer[i] = data_[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence_.load(std::memory_order_relaxed) != seq) return false;
+    out = make(reinterpret_cast<const unsigned char*>(buffer), std::index_sequence_for<S...>{});
+    return true;
+  }
+
+  STRONG_NODISCARD
+  value_type
+  load()
+  const
+  noexcept
+  {
+    word buffer[words];
+    for (;;)
+    {
+      const auto seq = sequence_.load(std::memory_order_acquire);
+      if (seq & 1U) continue;
+      for (std::size_t i = 0; i != words; ++i)
+      {
+        buffer[i] = data_[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (sequence_.load(std::memory_order_relaxed) == seq) break;
+    }
+    return make(reinterpret_cast<const unsigned char*>(buffer), std::index_sequence_for<S...>{});
+  }
+private:
+  template <std::size_t ... I>
+  static
+  void
+  store_fields(
+    unsigned char* p,
+    std::index_sequence<I...>,
+    const S& ... s)
+  noexcept
+  {
+    const int expand[] = { (std::memcpy(p + impl::field_offset<S...>(I), &s, sizeof(S)), 0)... };
+    (void)expand;
+  }
+
+  template <std::size_t ... I>
+  static
+  value_type
+  make(
+    const unsigned char* p,
+    std::index_sequence<I...>)
+  noexcept
+  {
+    return value_type(impl::from_bytes<S>(p + impl::field_offset<S...>(I))...);
+  }
+
+  std::atomic<unsigned> sequence_{0};
+  std::atomic<word> data_[words] = {};
+};
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_SEQLOCK_HPP_INCLUDED
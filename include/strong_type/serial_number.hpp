@@ -0,0 +1,252 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_SERIAL_NUMBER_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_SERIAL_NUMBER_HPP_INCLUDED
+
+#include "type.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace strong
+{
+
+// Sequence numbers that wrap around, with the serial number arithmetic of
+// RFC 1982. Use it instead of strong::ordered. a < b when b is less than half
+// the number space ahead of a. Exactly half the number space apart, the
+// order is undefined by the RFC, and here the one with the smaller value is
+// the smaller.
+struct serial_number
+{
+  template <typename T>
+  class modifier;
+};
+
+template <typename T, typename Tag, typename ... M>
+class serial_number::modifier<::strong::type<T, Tag, M...>>
+{
+  static_assert(std::is_unsigned<T>::value && !std::is_same<T, bool>::value,
+                "serial_number requires an unsigned integral underlying type");
+  using type = ::strong::type<T, Tag, M...>;
+public:
+  using difference_type = std::make_signed_t<T>;
+
+  friend
+  STRONG_CONSTEXPR
+  type&
+  operator+=(
+    type& s,
+    difference_type n)
+  noexcept
+  {
+    value_of(s) = static_cast<T>(value_of(s) + static_cast<T>(n));
+    return s;
+  }
+
+  friend
+  STRONG_CONSTEXPR
+  type&
+  operator-=(
+    type& s,
+    difference_type n)
+  noexcept
+  {
+    value_of(s) = static_cast<T>(value_of(s) - static_cast<T>(n));
+    return s;
+  }
+
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  type
+  operator+(
+    type s,
+    difference_type n)
+  noexcept
+  {
+    s += n;
+    return s;
+  }
+
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  type
+  operator+(
+    difference_type n,
+    type s)
+  noexcept
+  {
+    s += n;
+    return s;
+  }
+
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  type
+  operator-(
+    type s,
+    difference_type n)
+  noexcept
+  {
+    s -= n;
+    return s;
+  }
+
+  // The signed number of steps from rh to lh, modulo the number space.
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  difference_type
+  operator-(
+    const type& lh,
+    const type& rh)
+  noexcept
+  {
+    return static_cast<difference_type>(static_cast<T>(value_of(lh) - value_of(rh)));
+  }
+
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  difference_type
+  distance(
+    const type& from,
+    const type& to)
+  noexcept
+  {
+    return to - from;
+  }
+
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  bool
+  operator<(
+    const type& lh,
+    const type& rh)
+  noexcept
+  {
+    return precedes(lh, rh);
+  }
+
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  bool
+  operator<=(
+    const type& lh,
+    const type& rh)
+  noexcept
+  {
+    return !precedes(rh, lh);
+  }
+
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  bool
+  operator>(
+    const type& lh,
+    const type& rh)
+  noexcept
+  {
+    return precedes(rh, lh);
+  }
+
+  STRONG_NODISCARD
+  friend
+  STRONG_CONSTEXPR
+  bool
+  operator>=(
+    const type& lh,
+    const type& rh)
+  noexcept
+  {
+    return !precedes(lh, rh);
+  }
+private:
+  static
+  STRONG_CONSTEXPR
+  bool
+  precedes(
+    const type& lh,
+    const type& rh)
+  noexcept
+  {
+    const auto d = lh - rh;
+    return d < 0
+      && (d != std::numeric_limits<difference_type>::min() || value_of(lh) < value_of(rh));
+  }
+};
+
+// The first element of the first adjacent pair in [first, last), of a
+// strong::serial_number type, where the second is not the successor of the
+// first, or last if there is none. The pairs are compared a block at a time
+// without branches, so that the comparisons vectorize.
+template <typename S>
+STRONG_NODISCARD
+const S*
+find_gap(
+  const S* first,
+  const S* last)
+noexcept
+{
+  using T = underlying_type_t<S>;
+  if (first == last) return last;
+  const std::size_t pairs = static_cast<std::size_t>(last - first) - 1;
+  constexpr std::size_t block = 64;
+  std::size_t i = 0;
+  for (; i + block <= pairs; i += block)
+  {
+    unsigned gaps = 0;
+    for (std::size_t j = i; j != i + block; ++j)
+    {
+      gaps |= static_cast<T>(value_of(first[j + 1]) - value_of(first[j])) != 1;
+    }
+    if (gaps) break;
+  }
+  for (; i != pairs; ++i)
+  {
+    if (static_cast<T>(value_of(first[i + 1]) - value_of(first[i])) != 1) return first + i;
+  }
+  return last;
+}
+
+// The number of sequence numbers skipped between adjacent elements in
+// [first, last), of a strong::serial_number type. Repeated and reordered
+// elements do not count.
+template <typename S>
+STRONG_NODISCARD
+std::uint64_t
+count_missing(
+  const S* first,
+  const S* last)
+noexcept
+{
+  using T = underlying_type_t<S>;
+  using D = std::make_signed_t<T>;
+  const std::size_t pairs = first == last ? 0 : static_cast<std::size_t>(last - first) - 1;
+  std::uint64_t missing = 0;
+  for (std::size_t i = 0; i != pairs; ++i)
+  {
+    const auto d = static_cast<D>(static_cast<T>(value_of(first[i + 1]) - value_of(first[i])));
+    missing += d > 1 ? static_cast<std::uint64_t>(d - 1) : 0U;
+  }
+  return missing;
+}
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_SERIAL_NUMBER_HPP_INCLUDED
@@ -0,0 +1,373 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_SERIALIZABLE_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_SERIALIZABLE_HPP_INCLUDED
+
+#include "type.hpp"
+
+#include <cstring>
+#include <functional>
+
+namespace strong
+{
+
+enum class endian
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  little = 0,
+  big = 1,
+  native = little
+#else
+  little = __ORDER_LITTLE_ENDIAN__,
+  big = __ORDER_BIG_ENDIAN__,
+  native = __BYTE_ORDER__
+#endif
+};
+
+namespace impl
+{
+  template <typename B>
+  struct is_byte
+    : std::integral_constant<bool,
+                             std::is_same<B, unsigned char>::value ||
+                             std::is_same<B, char>::value
+#if __cplusplus >= 201703L
+                             || std::is_same<B, std::byte>::value
+#endif
+                            >
+  {
+  };
+
+#if STRONG_HAS_CONCEPTS
+  template <typename B>
+  concept byte_type = is_byte<B>::value;
+#else
+  template <typename B>
+  using WhenByte = std::enable_if_t<is_byte<B>::value>;
+#endif
+
+  inline void reverse_bytes(unsigned char* first, unsigned char* last) noexcept
+  {
+    while (first < last)
+    {
+      --last;
+      auto tmp = *first;
+      *first = *last;
+      *last = tmp;
+      ++first;
+    }
+  }
+
+  template <endian E, typename T>
+  void store_bytes(void* p, const T& t) noexcept
+  {
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &t, sizeof(T));
+    if (E != endian::native) reverse_bytes(bytes, bytes + sizeof(T));
+    std::memcpy(p, bytes, sizeof(T));
+  }
+
+  template <endian E, typename T>
+  void load_bytes(const void* p, T& t) noexcept
+  {
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, p, sizeof(T));
+    if (E != endian::native) reverse_bytes(bytes, bytes + sizeof(T));
+    std::memcpy(&t, bytes, sizeof(T));
+  }
+}
+
+template <endian E>
+struct serializable
+{
+  static_assert(E == endian::little || E == endian::big,
+                "byte order must be endian::little or endian::big");
+  template <typename T>
+  class modifier;
+};
+
+template <endian E>
+template <typename T, typename Tag, typename ... M>
+class serializable<E>::modifier<::strong::type<T, Tag, M...>>
+{
+  static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                "underlying type must be an arithmetic or enumeration type");
+  using type = ::strong::type<T, Tag, M...>;
+public:
+#if STRONG_HAS_CONCEPTS
+  template <impl::byte_type B>
+#else
+  template <typename B, typename = impl::WhenByte<B>>
+#endif
+  B*
+  write_to(
+    B* p)
+  const
+  noexcept
+  {
+    auto& self = static_cast<const type&>(*this);
+    impl::store_bytes<E>(p, value_of(self));
+    return p + sizeof(T);
+  }
+
+#if STRONG_HAS_CONCEPTS
+  template <impl::byte_type B>
+#else
+  template <typename B, typename = impl::WhenByte<B>>
+#endif
+  const B*
+  read_from(
+    const B* p)
+  noexcept
+  {
+    auto& self = static_cast<type&>(*this);
+    impl::load_bytes<E>(p, value_of(self));
+    return p + sizeof(T);
+  }
+};
+
+namespace impl
+{
+  template <typename S>
+  struct serialization_order
+  {
+    static_assert(type_is<S, serializable<endian::little>>::value ||
+                  type_is<S, serializable<endian::big>>::value,
+                  "the type must have the strong::serializable modifier");
+    static constexpr endian value = type_is<S, serializable<endian::little>>::value
+                                    ? endian::little
+                                    : endian::big;
+  };
+
+  // The object representation of S can be copied as is, if it is that of
+  // its underlying type and already in the requested byte order.
+  template <typename S>
+  using is_memcpy_serializable = std::integral_constant<bool,
+    serialization_order<S>::value == endian::native &&
+    std::is_trivially_copyable<S>::value &&
+    sizeof(S) == sizeof(underlying_type_t<S>)>;
+
+  template <typename S, typename B>
+  B* serialize(const S* first, std::size_t count, B* out, std::true_type) noexcept
+  {
+    if (count) std::memcpy(out, first, count * sizeof(S));
+    return out + count * sizeof(S);
+  }
+
+  template <typename S, typename B>
+  B* serialize(const S* first, std::size_t count, B* out, std::false_type) noexcept
+  {
+    for (std::size_t i = 0; i != count; ++i)
+    {
+      out = first[i].write_to(out);
+    }
+    return out;
+  }
+
+  template <typename S, typename B>
+  const B* deserialize(const B* in, std::size_t count, S* out, std::true_type) noexcept
+  {
+    if (count) std::memcpy(out, in, count * sizeof(S));
+    return in + count * sizeof(S);
+  }
+
+  template <typename S, typename B>
+  const B* deserialize(const B* in, std::size_t count, S* out, std::false_type) noexcept
+  {
+    for (std::size_t i = 0; i != count; ++i)
+    {
+      in = out[i].read_from(in);
+    }
+    return in;
+  }
+}
+
+// Writes count serializable strong values to out, each as the
+// sizeof(underlying_type_t<S>) bytes of its underlying value in the byte
+// order of the modifier, with no padding in between. This is a single
+// memcpy when that order is the native one. Returns the end of the output.
+#if STRONG_HAS_CONCEPTS
+template <typename S, impl::byte_type B>
+#else
+template <typename S, typename B, typename = impl::WhenByte<B>>
+#endif
+B*
+serialize(
+  const S* first,
+  std::size_t count,
+  B* out)
+noexcept
+{
+  return impl::serialize(first, count, out, impl::is_memcpy_serializable<S>{});
+}
+
+// Reads count serializable strong values, as written by serialize(), into
+// the already existing objects pointed to by out. Returns the end of the
+// input.
+#if STRONG_HAS_CONCEPTS
+template <typename S, impl::byte_type B>
+#else
+template <typename S, typename B, typename = impl::WhenByte<B>>
+#endif
+const B*
+deserialize(
+  const B* in,
+  std::size_t count,
+  S* out)
+noexcept
+{
+  return impl::deserialize(in, count, out, impl::is_memcpy_serializable<S>{});
+}
+
+namespace impl
+{
+  // Compound assignment, increment and decrement for underlying types that
+  // store their value in another representation, and can only load() and
+  // store() it. They are noexcept when store() is.
+  template <typename D, typename V>
+  class storage_operators
+  {
+    static constexpr bool nothrow_store() noexcept
+    {
+      return noexcept(std::declval<D&>().store(std::declval<V>()));
+    }
+  public:
+    D& operator+=(const V& v) noexcept(nothrow_store()) { return update([&](V x) { return x + v; }); }
+    D& operator-=(const V& v) noexcept(nothrow_store()) { return update([&](V x) { return x - v; }); }
+    D& operator*=(const V& v) noexcept(nothrow_store()) { return update([&](V x) { return x * v; }); }
+    D& operator/=(const V& v) noexcept(nothrow_store()) { return update([&](V x) { return x / v; }); }
+    D& operator%=(const V& v) noexcept(nothrow_store()) { return update([&](V x) { return x % v; }); }
+    D& operator&=(const V& v) noexcept(nothrow_store()) { return update([&](V x) { return x & v; }); }
+    D& operator|=(const V& v) noexcept(nothrow_store()) { return update([&](V x) { return x | v; }); }
+    D& operator^=(const V& v) noexcept(nothrow_store()) { return update([&](V x) { return x ^ v; }); }
+    template <typename C>
+    D& operator<<=(C c) noexcept(nothrow_store()) { return update([&](V x) { return x << c; }); }
+    template <typename C>
+    D& operator>>=(C c) noexcept(nothrow_store()) { return update([&](V x) { return x >> c; }); }
+    D& operator++() noexcept(nothrow_store()) { return update([](V x) { return ++x; }); }
+    D& operator--() noexcept(nothrow_store()) { return update([](V x) { return --x; }); }
+    V operator++(int) noexcept(nothrow_store()) { V r = self().load(); ++*this; return r; }
+    V operator--(int) noexcept(nothrow_store()) { V r = self().load(); --*this; return r; }
+  private:
+    D& self() noexcept { return static_cast<D&>(*this); }
+    template <typename F>
+    D& update(F f) noexcept(nothrow_store())
+    {
+      self().store(static_cast<V>(f(self().load())));
+      return self();
+    }
+  };
+}
+
+// An underlying type for strong::type that keeps the bytes of a T in byte
+// order E, with alignment 1, so that it can be overlaid directly on wire or
+// file data. The value is converted on access, and equality compares the
+// stored bytes without conversion.
+template <typename T, endian E>
+class endian_storage
+  : public impl::storage_operators<endian_storage<T, E>, T>
+{
+  static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                "underlying type must be an integral or enumeration type");
+public:
+  using value_type = T;
+
+  endian_storage() = default;
+
+  explicit
+  endian_storage(
+    T t)
+  noexcept
+  {
+    store(t);
+  }
+
+  endian_storage&
+  operator=(
+    T t)
+  noexcept
+  {
+    store(t);
+    return *this;
+  }
+
+  operator T() const noexcept { return load(); }
+
+  STRONG_NODISCARD
+  T
+  load()
+  const
+  noexcept
+  {
+    T t;
+    impl::load_bytes<E>(bytes_, t);
+    return t;
+  }
+
+  void
+  store(
+    T t)
+  noexcept
+  {
+    impl::store_bytes<E>(bytes_, t);
+  }
+
+  STRONG_NODISCARD
+  friend
+  bool
+  operator==(
+    const endian_storage& lh,
+    const endian_storage& rh)
+  noexcept
+  {
+    return std::memcmp(lh.bytes_, rh.bytes_, sizeof(T)) == 0;
+  }
+
+  STRONG_NODISCARD
+  friend
+  bool
+  operator!=(
+    const endian_storage& lh,
+    const endian_storage& rh)
+  noexcept
+  {
+    return !(lh == rh);
+  }
+private:
+  unsigned char bytes_[sizeof(T)];
+};
+
+template <typename T>
+using big_endian = endian_storage<T, endian::big>;
+
+template <typename T>
+using little_endian = endian_storage<T, endian::little>;
+
+}
+
+namespace std {
+template <typename T, ::strong::endian E>
+struct hash<::strong::endian_storage<T, E>>
+{
+  decltype(auto)
+  operator()(
+    const ::strong::endian_storage<T, E>& t)
+  const
+  noexcept(noexcept(std::declval<hash<T>>()(std::declval<T>())))
+  {
+    return hash<T>{}(t.load());
+  }
+};
+}
+#endif //ROLLBEAR_STRONG_TYPE_SERIALIZABLE_HPP_INCLUDED
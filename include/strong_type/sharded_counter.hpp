@@ -0,0 +1,135 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_SHARDED_COUNTER_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_SHARDED_COUNTER_HPP_INCLUDED
+
+#include "atomic.hpp"
+#include "per_thread_array.hpp"
+
+namespace strong
+{
+
+// The updates are constrained as the read-modify-write operations of
+// strong::atomic<S> are.
+#if STRONG_HAS_CONCEPTS
+#define STRONG_ATOMIC_TEMPLATE(when)
+#define STRONG_ATOMIC_REQUIRES(concept_) requires concept_<S>
+#else
+#define STRONG_ATOMIC_TEMPLATE(when) template <typename SS = S, typename = impl::when<SS>>
+#define STRONG_ATOMIC_REQUIRES(concept_)
+#endif
+
+// A counter that many threads can update without contending for a cache
+// line. Each thread updates a shard of its own, and reading sums the shards.
+// Only the updates that the modifiers of S allow are available.
+template <typename S>
+class sharded_counter
+{
+  using T = underlying_type_t<S>;
+  static_assert(type_is<S, arithmetic>::value || type_is<S, difference>::value ||
+                type_is<S, incrementable>::value,
+                "strong::sharded_counter<S> requires strong::arithmetic, strong::difference or strong::incrementable");
+public:
+  using value_type = S;
+
+  explicit
+  sharded_counter(
+    std::size_t shards = per_thread_array<S>::default_size())
+  : shards_(S{T{}}, shards)
+  {
+  }
+
+  STRONG_ATOMIC_TEMPLATE(WhenFetchAddable)
+  sharded_counter&
+  operator+=(
+    const S& s)
+  STRONG_ATOMIC_REQUIRES(impl::fetch_addable)
+  {
+    shards_.local().fetch_add(s, std::memory_order_relaxed);
+    return *this;
+  }
+
+  STRONG_ATOMIC_TEMPLATE(WhenFetchAddable)
+  sharded_counter&
+  operator-=(
+    const S& s)
+  STRONG_ATOMIC_REQUIRES(impl::fetch_addable)
+  {
+    shards_.local().fetch_sub(s, std::memory_order_relaxed);
+    return *this;
+  }
+
+  STRONG_ATOMIC_TEMPLATE(WhenIncrementable)
+  sharded_counter&
+  operator++()
+  STRONG_ATOMIC_REQUIRES(incrementable_type)
+  {
+    ++shards_.local();
+    return *this;
+  }
+
+  STRONG_ATOMIC_TEMPLATE(WhenDecrementable)
+  sharded_counter&
+  operator--()
+  STRONG_ATOMIC_REQUIRES(decrementable_type)
+  {
+    --shards_.local();
+    return *this;
+  }
+
+  // The sum of all shards. Updates that happen concurrently with the read
+  // may or may not be included.
+  STRONG_NODISCARD
+  S
+  load()
+  const
+  noexcept
+  {
+    T sum{};
+    shards_.for_each([&sum](const atomic<S>& shard) {
+      sum = static_cast<T>(sum + value_of(shard.load(std::memory_order_relaxed)));
+    });
+    return S{sum};
+  }
+
+  operator S() const noexcept { return load(); }
+
+  // Sets all shards to zero. Updates that happen concurrently with the reset
+  // may or may not be lost.
+  void
+  reset()
+  noexcept
+  {
+    shards_.for_each([](atomic<S>& shard) {
+      shard.store(S{T{}}, std::memory_order_relaxed);
+    });
+  }
+
+  STRONG_NODISCARD
+  std::size_t
+  shards()
+  const
+  noexcept
+  {
+    return shards_.size();
+  }
+private:
+  per_thread_array<atomic<S>> shards_;
+};
+
+#undef STRONG_ATOMIC_TEMPLATE
+#undef STRONG_ATOMIC_REQUIRES
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_SHARDED_COUNTER_HPP_INCLUDED
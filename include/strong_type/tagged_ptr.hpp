@@ -0,0 +1,343 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_TAGGED_PTR_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_TAGGED_PTR_HPP_INCLUDED
+
+#include "atomic.hpp"
+#include "equality.hpp"
+#include "pointer.hpp"
+
+#include <cstdint>
+
+// The number of unused high address bits of user space pointers. Define it to
+// 0 on systems where user space may use the whole address space, for example
+// x86-64 with 5 level paging. It is 0 on 64 bit ARM, where top byte ignore
+// and memory tagging let the system keep tags in the top byte of pointers,
+// as Android does for heap pointers. Define it to at most 8 there only if
+// no pointers are tagged.
+#if !defined(STRONG_TAGGED_PTR_HIGH_BITS)
+#if defined(__x86_64__) || defined(_M_X64)
+#define STRONG_TAGGED_PTR_HIGH_BITS 16
+#else
+#define STRONG_TAGGED_PTR_HIGH_BITS 0
+#endif
+#endif
+
+namespace strong
+{
+
+namespace impl
+{
+  constexpr unsigned ilog2(std::size_t n) noexcept
+  {
+    return n <= 1 ? 0 : 1 + ilog2(n / 2);
+  }
+
+  // A pointer to T and a tag of TagBits bits in one word. The pointer is
+  // shifted up over the unused high address bits, and the tag is stored in
+  // the low bits, that are then free, together with the bits that are always
+  // 0 by the alignment of T.
+  template <typename T, unsigned TagBits>
+  class tagged_word
+  {
+    static constexpr unsigned high_bits = STRONG_TAGGED_PTR_HIGH_BITS;
+    static_assert(TagBits <= high_bits + ilog2(alignof(T)),
+                  "too many tag bits for the alignment of T on this platform");
+  public:
+    using tag_type = std::uintptr_t;
+    static constexpr unsigned tag_bits = TagBits;
+    static constexpr tag_type tag_mask = (tag_type{1} << TagBits) - 1;
+
+    tagged_word() noexcept = default;
+
+    constexpr
+    tagged_word(
+      std::nullptr_t,
+      tag_type tag = 0)
+    noexcept
+    : word_(tag & tag_mask)
+    {
+    }
+
+    explicit
+    tagged_word(
+      T* p,
+      tag_type tag = 0)
+    noexcept
+    : word_((reinterpret_cast<std::uintptr_t>(p) << high_bits) | (tag & tag_mask))
+    {
+    }
+
+    STRONG_NODISCARD
+    static
+    constexpr
+    tagged_word
+    from_word(
+      std::uintptr_t w)
+    noexcept
+    {
+      tagged_word t;
+      t.word_ = w;
+      return t;
+    }
+
+    STRONG_NODISCARD
+    constexpr
+    std::uintptr_t
+    word()
+    const
+    noexcept
+    {
+      return word_;
+    }
+
+    STRONG_NODISCARD
+    T*
+    get()
+    const
+    noexcept
+    {
+      return reinterpret_cast<T*>((word_ & ~tag_mask) >> high_bits);
+    }
+
+    STRONG_NODISCARD
+    constexpr
+    tag_type
+    tag()
+    const
+    noexcept
+    {
+      return word_ & tag_mask;
+    }
+
+    T& operator*() const noexcept { return *get(); }
+    T* operator->() const noexcept { return get(); }
+
+    friend bool operator==(const tagged_word& t, std::nullptr_t) noexcept { return t.get() == nullptr; }
+    friend bool operator==(std::nullptr_t, const tagged_word& t) noexcept { return t.get() == nullptr; }
+    friend bool operator!=(const tagged_word& t, std::nullptr_t) noexcept { return t.get() != nullptr; }
+    friend bool operator!=(std::nullptr_t, const tagged_word& t) noexcept { return t.get() != nullptr; }
+    friend constexpr bool operator==(const tagged_word& l, const tagged_word& r) noexcept { return l.word_ == r.word_; }
+    friend constexpr bool operator!=(const tagged_word& l, const tagged_word& r) noexcept { return l.word_ != r.word_; }
+  private:
+    std::uintptr_t word_;
+  };
+
+#if __cplusplus < 201703L
+  template <typename T, unsigned TagBits>
+  constexpr unsigned tagged_word<T, TagBits>::high_bits;
+  template <typename T, unsigned TagBits>
+  constexpr unsigned tagged_word<T, TagBits>::tag_bits;
+  template <typename T, unsigned TagBits>
+  constexpr typename tagged_word<T, TagBits>::tag_type tagged_word<T, TagBits>::tag_mask;
+#endif
+
+  struct tagged_access
+  {
+    template <typename T>
+    class modifier;
+  };
+
+  template <typename P, unsigned B, typename Tag, typename ... M>
+  class tagged_access::modifier<::strong::type<tagged_word<P, B>, Tag, M...>>
+  {
+    using type = ::strong::type<tagged_word<P, B>, Tag, M...>;
+  public:
+    using tag_type = typename tagged_word<P, B>::tag_type;
+    static constexpr unsigned tag_bits = B;
+
+    STRONG_NODISCARD
+    P*
+    get()
+    const
+    noexcept
+    {
+      return value_of(static_cast<const type&>(*this)).get();
+    }
+
+    STRONG_NODISCARD
+    constexpr
+    tag_type
+    tag()
+    const
+    noexcept
+    {
+      return value_of(static_cast<const type&>(*this)).tag();
+    }
+
+    STRONG_NODISCARD
+    type
+    with_tag(
+      tag_type tag)
+    const
+    noexcept
+    {
+      return type{get(), tag};
+    }
+
+    // p, with the tag after this one, wrapping at the tag width. This is the
+    // value to publish with compare and exchange, to avoid the ABA problem.
+    STRONG_NODISCARD
+    type
+    with_next_tag(
+      P* p)
+    const
+    noexcept
+    {
+      return type{p, tag() + 1};
+    }
+  };
+}
+
+// A strong::pointer to T, that also holds a tag of TagBits bits, with the size
+// of a pointer so that it can be updated with a single word compare and
+// exchange.
+template <typename T, typename Tag, unsigned TagBits, typename ... M>
+using tagged_ptr = type<impl::tagged_word<T, TagBits>, Tag,
+                        pointer, equality, impl::tagged_access, M...>;
+
+// Always operates on a single std::uintptr_t.
+template <typename T, unsigned B, typename Tag, typename ... M>
+class atomic<::strong::type<impl::tagged_word<T, B>, Tag, M...>>
+{
+  using S = ::strong::type<impl::tagged_word<T, B>, Tag, M...>;
+  using W = impl::tagged_word<T, B>;
+public:
+  using value_type = S;
+#if __cplusplus >= 201703L
+  static constexpr bool is_always_lock_free = std::atomic<std::uintptr_t>::is_always_lock_free;
+#endif
+
+  atomic() noexcept = default;
+
+  constexpr
+  atomic(
+    const S& s)
+  noexcept
+  : a_(value_of(s).word())
+  {
+  }
+
+  atomic(const atomic&) = delete;
+  atomic& operator=(const atomic&) = delete;
+
+  S
+  operator=(
+    const S& s)
+  noexcept
+  {
+    store(s);
+    return s;
+  }
+
+  STRONG_NODISCARD
+  bool
+  is_lock_free()
+  const
+  noexcept
+  {
+    return a_.is_lock_free();
+  }
+
+  STRONG_NODISCARD
+  S
+  load(
+    std::memory_order o = std::memory_order_seq_cst)
+  const
+  noexcept
+  {
+    return make(a_.load(o));
+  }
+
+  void
+  store(
+    const S& s,
+    std::memory_order o = std::memory_order_seq_cst)
+  noexcept
+  {
+    a_.store(value_of(s).word(), o);
+  }
+
+  operator S() const noexcept { return load(); }
+
+  S
+  exchange(
+    const S& s,
+    std::memory_order o = std::memory_order_seq_cst)
+  noexcept
+  {
+    return make(a_.exchange(value_of(s).word(), o));
+  }
+
+  bool
+  compare_exchange_weak(
+    S& expected,
+    const S& desired,
+    std::memory_order success,
+    std::memory_order failure)
+  noexcept
+  {
+    auto e = value_of(expected).word();
+    const bool r = a_.compare_exchange_weak(e, value_of(desired).word(), success, failure);
+    expected = make(e);
+    return r;
+  }
+
+  bool
+  compare_exchange_weak(
+    S& expected,
+    const S& desired,
+    std::memory_order o = std::memory_order_seq_cst)
+  noexcept
+  {
+    auto e = value_of(expected).word();
+    const bool r = a_.compare_exchange_weak(e, value_of(desired).word(), o);
+    expected = make(e);
+    return r;
+  }
+
+  bool
+  compare_exchange_strong(
+    S& expected,
+    const S& desired,
+    std::memory_order success,
+    std::memory_order failure)
+  noexcept
+  {
+    auto e = value_of(expected).word();
+    const bool r = a_.compare_exchange_strong(e, value_of(desired).word(), success, failure);
+    expected = make(e);
+    return r;
+  }
+
+  bool
+  compare_exchange_strong(
+    S& expected,
+    const S& desired,
+    std::memory_order o = std::memory_order_seq_cst)
+  noexcept
+  {
+    auto e = value_of(expected).word();
+    const bool r = a_.compare_exchange_strong(e, value_of(desired).word(), o);
+    expected = make(e);
+    return r;
+  }
+private:
+  static S make(std::uintptr_t w) noexcept { return S{W::from_word(w)}; }
+
+  std::atomic<std::uintptr_t> a_;
+};
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_TAGGED_PTR_HPP_INCLUDED
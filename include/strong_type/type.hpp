@@ -0,0 +1,568 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_TYPE_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_TYPE_HPP_INCLUDED
+
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 201703L
+#define STRONG_NODISCARD [[nodiscard]]
+#else
+#define STRONG_NODISCARD
+#endif
+
+// With C++20 concepts, constraints are requires-clauses and the named
+// concepts, like strong::arithmetic_type, are available. Define it to 0 to
+// use the C++14 std::enable_if constraints.
+#if !defined(STRONG_HAS_CONCEPTS)
+#if defined(__cpp_concepts) && __cpp_concepts >= 201907L
+#define STRONG_HAS_CONCEPTS 1
+#else
+#define STRONG_HAS_CONCEPTS 0
+#endif
+#endif
+
+// Tag constants have external linkage where inline variables exist, which a
+// module interface requires of exported names.
+#if defined(__cpp_inline_variables) && __cpp_inline_variables >= 201606L
+#define STRONG_INLINE_VARIABLE inline
+#else
+#define STRONG_INLINE_VARIABLE static
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__) && __MSC_VER < 1922
+#define STRONG_CONSTEXPR
+#else
+#define STRONG_CONSTEXPR constexpr
+#endif
+
+// Checked builds verify the invariants of modifiers like strong::bounded<>,
+// which unchecked builds only assume. By default, builds without NDEBUG are
+// checked.
+#if !defined(STRONG_CHECKED)
+#if defined(NDEBUG)
+#define STRONG_CHECKED 0
+#else
+#define STRONG_CHECKED 1
+#endif
+#endif
+
+// Tells the optimizer that cond, which must not have side effects, is true.
+#if __cplusplus > 202002L && defined(__has_cpp_attribute)
+#if __has_cpp_attribute(assume)
+#define STRONG_ASSUME(cond) [[assume(cond)]]
+#endif
+#endif
+#if !defined(STRONG_ASSUME)
+#if defined(__clang__)
+#define STRONG_ASSUME(cond) __builtin_assume(cond)
+#elif defined(__GNUC__)
+#define STRONG_ASSUME(cond) do { if (!(cond)) __builtin_unreachable(); } while (false)
+#elif defined(_MSC_VER)
+#define STRONG_ASSUME(cond) __assume(cond)
+#else
+#define STRONG_ASSUME(cond) static_cast<void>(0)
+#endif
+#endif
+
+namespace strong
+{
+
+namespace impl
+{
+  template <typename T, typename ... V>
+  using WhenConstructible = std::enable_if_t<std::is_constructible<T, V...>::value>;
+}
+
+template <typename M, typename T>
+using modifier = typename M::template modifier<T>;
+
+namespace impl
+{
+  template <typename ...>
+  using void_t = void;
+
+  template <bool ... B>
+  struct bool_pack;
+
+  template <bool ... B>
+  using all_of = std::is_same<bool_pack<true, B...>, bool_pack<B..., true>>;
+
+  template <bool ... B>
+  using any_of = std::integral_constant<bool, !std::is_same<bool_pack<false, B...>, bool_pack<B..., false>>::value>;
+
+  template <typename ... M>
+  struct modifier_list {};
+
+  template <typename ... Ls>
+  struct concat_modifiers
+  {
+    using type = modifier_list<>;
+  };
+
+  template <typename ... A>
+  struct concat_modifiers<modifier_list<A...>>
+  {
+    using type = modifier_list<A...>;
+  };
+
+  template <typename ... A, typename ... B, typename ... Ls>
+  struct concat_modifiers<modifier_list<A...>, modifier_list<B...>, Ls...>
+    : concat_modifiers<modifier_list<A..., B...>, Ls...>
+  {
+  };
+
+  template <typename Out, typename ... In>
+  struct unique_modifiers
+  {
+    using type = Out;
+  };
+
+  template <typename ... O, typename H, typename ... In>
+  struct unique_modifiers<modifier_list<O...>, H, In...>
+    : unique_modifiers<std::conditional_t<any_of<std::is_same<H, O>::value...>::value,
+                                          modifier_list<O...>,
+                                          modifier_list<O..., H>>,
+                       In...>
+  {
+  };
+
+  template <typename L>
+  struct unique_list;
+
+  template <typename ... M>
+  struct unique_list<modifier_list<M...>> : unique_modifiers<modifier_list<>, M...> {};
+
+  template <typename T, typename L>
+  struct flatten_modifiers;
+
+  // A composite modifier M declares the modifiers it is made of, for the
+  // underlying type T, as `template <typename T> using expands_to = modifier_list<...>`.
+  template <typename M, typename T, typename = void>
+  struct expand_modifier
+  {
+    using type = modifier_list<M>;
+  };
+
+  template <typename M, typename T>
+  struct expand_modifier<M, T, void_t<typename M::template expands_to<T>>>
+    : flatten_modifiers<T, typename M::template expands_to<T>>
+  {
+  };
+
+  // The modifiers in L, with composite modifiers recursively replaced by the
+  // modifiers they are made of, and every modifier only once, in the order
+  // they are first mentioned. It depends on the underlying type T rather
+  // than on the strong type, so that it is computed once for all strong types
+  // with the same underlying type and modifiers.
+  template <typename T, typename ... M>
+  struct flatten_modifiers<T, modifier_list<M...>>
+    : unique_list<typename concat_modifiers<typename expand_modifier<M, T>::type...>::type>
+  {
+  };
+
+  template <typename S, typename L>
+  class modifier_bases;
+
+  template <typename S, typename ... M>
+  class modifier_bases<S, modifier_list<M...>> : public ::strong::modifier<M, S>...
+  {
+  };
+}
+
+struct uninitialized_t {};
+STRONG_INLINE_VARIABLE constexpr uninitialized_t uninitialized{};
+
+struct default_constructible
+{
+  template <typename T>
+  class modifier
+  {
+  };
+};
+
+namespace impl {
+  // A modifier with an invariant on the value checks it in a hidden friend
+  // check_invariant(const type*, const T&), found by argument dependent
+  // lookup, which is called when a value is constructed from arguments.
+  template <typename T>
+  STRONG_CONSTEXPR
+  void
+  check_invariant(
+    const void*,
+    const T&)
+  noexcept
+  {
+  }
+
+  template <typename S, typename T>
+  STRONG_CONSTEXPR
+  void
+  verify_construction(
+    const S* s,
+    const T& t)
+  noexcept(noexcept(check_invariant(s, t)))
+  {
+    check_invariant(s, t);
+  }
+
+  template <typename T>
+  constexpr bool supports_default_construction(const ::strong::default_constructible::modifier<T>*)
+  {
+    return true;
+  }
+
+  // std::allocator_arg_t, once <strong_type/uses_allocator.hpp> is included,
+  // which keeps <memory> out of this header.
+  template <typename Arg>
+  struct is_allocator_arg : std::false_type {};
+
+  // T can be constructed from U... with the allocator A, first or last.
+  template <typename T, typename Arg, typename A, typename ... U>
+  using allocator_constructible = std::integral_constant<bool,
+    is_allocator_arg<Arg>::value
+    && (std::is_constructible<T, const Arg&, const A&, U...>::value
+        || std::is_constructible<T, U..., const A&>::value)>;
+
+#if STRONG_HAS_CONCEPTS
+  template <typename S>
+  concept default_constructible_type = requires (S* s) { supports_default_construction(s); };
+#endif
+}
+
+template <typename T, typename Tag, typename ... M>
+class type
+  : public impl::modifier_bases<
+      type<T, Tag, M...>,
+      typename impl::flatten_modifiers<T, impl::modifier_list<M...>>::type
+    >
+{
+public:
+#if STRONG_HAS_CONCEPTS
+  explicit type(uninitialized_t)
+    noexcept
+    requires std::is_trivially_constructible_v<T>
+  {
+  }
+  constexpr
+  type()
+    noexcept(noexcept(T{}))
+    requires impl::default_constructible_type<type>
+  : val{}
+  {
+  }
+
+  template <typename U>
+    requires std::is_constructible_v<T, std::initializer_list<U>>
+  constexpr
+  explicit
+  type(
+    std::initializer_list<U> us
+  )
+    noexcept(noexcept(T{us}))
+  : val{us}
+  {
+  }
+  template <typename ... U>
+    requires (sizeof...(U) > 0 && std::is_constructible_v<T, U&&...>)
+  constexpr
+  explicit
+  type(
+    U&& ... u)
+  noexcept(std::is_nothrow_constructible_v<T, U...>
+           && noexcept(impl::verify_construction(std::declval<const type*>(), std::declval<const T&>())))
+  : val(std::forward<U>(u)...)
+  {
+    impl::verify_construction(this, val);
+  }
+
+  // Uses-allocator construction, enabled by <strong_type/uses_allocator.hpp>,
+  // so that containers like std::pmr::vector<> pass their allocator on to
+  // the values of strong types they hold. The value constructor above takes
+  // a leading std::allocator_arg, and these pass the allocator last to an
+  // underlying type that takes it last, and copy and move with an allocator.
+  template <typename Arg, typename A, typename ... U>
+    requires (impl::is_allocator_arg<Arg>::value
+              && !std::is_constructible_v<T, const Arg&, const A&, U&&...>
+              && std::is_constructible_v<T, U&&..., const A&>)
+  constexpr
+  explicit
+  type(
+    const Arg&,
+    const A& a,
+    U&& ... u)
+  noexcept(std::is_nothrow_constructible_v<T, U..., const A&>
+           && noexcept(impl::verify_construction(std::declval<const type*>(), std::declval<const T&>())))
+  : val(std::forward<U>(u)..., a)
+  {
+    impl::verify_construction(this, val);
+  }
+  template <typename Arg, typename A>
+    requires impl::allocator_constructible<T, Arg, A, const T&>::value
+  constexpr
+  explicit
+  type(
+    const Arg& arg,
+    const A& a,
+    const type& other)
+  noexcept(noexcept(type(arg, a, other.val)))
+  : type(arg, a, other.val)
+  {
+  }
+  template <typename Arg, typename A>
+    requires impl::allocator_constructible<T, Arg, A, T&&>::value
+  constexpr
+  explicit
+  type(
+    const Arg& arg,
+    const A& a,
+    type&& other)
+  noexcept(noexcept(type(arg, a, std::move(other.val))))
+  : type(arg, a, std::move(other.val))
+  {
+  }
+#else
+  template <typename TT = T, typename = std::enable_if_t<std::is_trivially_constructible<TT>{}>>
+  explicit type(uninitialized_t)
+    noexcept
+  {
+  }
+  template <typename type_ = type,
+            bool = impl::supports_default_construction(static_cast<type_*>(nullptr))>
+  constexpr
+  type()
+    noexcept(noexcept(T{}))
+  : val{}
+  {
+  }
+
+  template <typename U,
+    typename = impl::WhenConstructible<T, std::initializer_list<U>>>
+  constexpr
+  explicit
+  type(
+    std::initializer_list<U> us
+  )
+    noexcept(noexcept(T{us}))
+  : val{us}
+  {
+  }
+  template <typename ... U,
+            typename = std::enable_if_t<std::is_constructible<T, U&&...>::value && (sizeof...(U) > 0)>>
+  constexpr
+  explicit
+  type(
+    U&& ... u)
+  noexcept(std::is_nothrow_constructible<T, U...>::value
+           && noexcept(impl::verify_construction(std::declval<const type*>(), std::declval<const T&>())))
+  : val(std::forward<U>(u)...)
+  {
+    impl::verify_construction(this, val);
+  }
+
+  template <typename Arg,
+            typename A,
+            typename ... U,
+            typename = std::enable_if_t<impl::is_allocator_arg<Arg>::value
+                                        && !std::is_constructible<T, const Arg&, const A&, U&&...>::value
+                                        && std::is_constructible<T, U&&..., const A&>::value>>
+  constexpr
+  explicit
+  type(
+    const Arg&,
+    const A& a,
+    U&& ... u)
+  noexcept(std::is_nothrow_constructible<T, U..., const A&>::value
+           && noexcept(impl::verify_construction(std::declval<const type*>(), std::declval<const T&>())))
+  : val(std::forward<U>(u)..., a)
+  {
+    impl::verify_construction(this, val);
+  }
+  template <typename Arg,
+            typename A,
+            typename = std::enable_if_t<impl::allocator_constructible<T, Arg, A, const T&>::value>>
+  constexpr
+  explicit
+  type(
+    const Arg& arg,
+    const A& a,
+    const type& other)
+  noexcept(noexcept(type(arg, a, other.val)))
+  : type(arg, a, other.val)
+  {
+  }
+  template <typename Arg,
+            typename A,
+            typename = std::enable_if_t<impl::allocator_constructible<T, Arg, A, T&&>::value>>
+  constexpr
+  explicit
+  type(
+    const Arg& arg,
+    const A& a,
+    type&& other)
+  noexcept(noexcept(type(arg, a, std::move(other.val))))
+  : type(arg, a, std::move(other.val))
+  {
+  }
+#endif
+
+  friend void swap(type& a, type& b) noexcept(
+                                        std::is_nothrow_move_constructible<type>::value &&
+                                        std::is_nothrow_move_assignable<type>::value
+                                      )
+  {
+    using std::swap;
+    swap(a.val, b.val);
+  }
+
+  STRONG_NODISCARD
+  constexpr T& value_of() & noexcept { return val;}
+  STRONG_NODISCARD
+  constexpr const T& value_of() const & noexcept { return val;}
+  STRONG_NODISCARD
+  constexpr T&& value_of() && noexcept { return std::move(val);}
+
+  STRONG_NODISCARD
+  friend constexpr T& value_of(type& t) noexcept { return t.val;}
+  STRONG_NODISCARD
+  friend constexpr const T& value_of(const type& t) noexcept { return t.val;}
+  STRONG_NODISCARD
+  friend constexpr T&& value_of(type&& t) noexcept { return std::move(t).val;}
+private:
+  T val;
+};
+
+namespace impl {
+  template <typename T, typename Tag, typename ... Ms>
+  constexpr bool is_strong_type_func(const strong::type<T, Tag, Ms...>*) { return true;}
+  constexpr bool is_strong_type_func(...) { return false;}
+  template <typename T, typename Tag, typename ... Ms>
+  constexpr T underlying_type(strong::type<T, Tag, Ms...>*);
+  template <typename T, typename Tag, typename ... Ms>
+  constexpr strong::type<T, Tag, Ms...>* strong_type_of(strong::type<T, Tag, Ms...>*);
+
+}
+
+template <typename T>
+struct is_strong_type : std::integral_constant<bool, impl::is_strong_type_func(static_cast<T *>(nullptr))> {};
+
+namespace impl {
+  template <typename T>
+  using WhenStrongType = std::enable_if_t<is_strong_type<std::decay_t<T>>::value>;
+  template <typename T>
+  using WhenNotStrongType = std::enable_if_t<!is_strong_type<std::decay_t<T>>::value>;
+}
+
+template <typename T, bool = is_strong_type<T>::value>
+struct underlying_type
+{
+  using type = decltype(impl::underlying_type(static_cast<T*>(nullptr)));
+};
+
+template <typename T>
+struct underlying_type<T, false>
+{
+  using type = T;
+};
+
+template <typename T>
+using underlying_type_t = typename underlying_type<T>::type;
+
+namespace impl
+{
+  template <typename T, typename Tag, typename ... Ms>
+  typename flatten_modifiers<T, modifier_list<Ms...>>::type
+  modifiers_of(strong::type<T, Tag, Ms...>*);
+
+  template <typename M, typename L>
+  struct has_modifier;
+
+  template <typename M, typename ... Ms>
+  struct has_modifier<M, modifier_list<Ms...>> : any_of<std::is_same<M, Ms>::value...> {};
+
+  template <typename L, typename Ms>
+  struct has_modifiers;
+
+  template <typename ... M, typename Ms>
+  struct has_modifiers<modifier_list<M...>, Ms> : all_of<has_modifier<M, Ms>::value...> {};
+}
+
+// True if the strong type T has the modifier M, either directly or as a part
+// of a composite modifier. For a composite M, T must have all its parts.
+template <typename T, typename M, bool = is_strong_type<T>::value>
+struct type_is
+  : impl::has_modifiers<
+      typename impl::expand_modifier<M, underlying_type_t<T>>::type,
+      decltype(impl::modifiers_of(static_cast<T*>(nullptr)))>
+{
+};
+
+template <typename T, typename M>
+struct type_is<T, M, false> : std::false_type
+{
+};
+
+namespace impl {
+#if STRONG_HAS_CONCEPTS
+  template <typename T>
+  concept strong_value = is_strong_type<std::decay_t<T>>::value;
+
+  template <typename T>
+  constexpr
+  T &&
+  access(T &&t)
+  noexcept {
+    return std::forward<T>(t);
+  }
+  template <strong_value T>
+  STRONG_NODISCARD
+#else
+  template<
+    typename T,
+    typename = impl::WhenNotStrongType<T>>
+  constexpr
+  T &&
+  access(T &&t)
+  noexcept {
+    return std::forward<T>(t);
+  }
+  template <
+    typename T,
+    typename = impl::WhenStrongType<T>>
+  STRONG_NODISCARD
+#endif
+  constexpr
+  auto
+  access(T&& t)
+  noexcept
+  -> decltype(value_of(std::forward<T>(t)))
+  {
+    return value_of(std::forward<T>(t));
+  }
+
+}
+
+#if STRONG_HAS_CONCEPTS
+template <typename T>
+concept strong_type = is_strong_type<T>::value;
+
+template <typename T, typename M>
+concept type_with = strong_type<T> && type_is<T, M>::value;
+#endif
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_TYPE_HPP_INCLUDED
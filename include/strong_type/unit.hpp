@@ -0,0 +1,248 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_UNIT_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_UNIT_HPP_INCLUDED
+
+#include "difference.hpp"
+#include "equality.hpp"
+
+#include <cstdint>
+#include <ratio>
+
+namespace strong
+{
+
+// The exponents of the base dimensions of a quantity, by position. What the
+// positions mean is up to you, for example length, mass and time with
+// dimension<1>, dimension<0,1> and dimension<0,0,1>. Trailing zeros are
+// insignificant, and dimension<> is dimensionless.
+template <int ... Exponents>
+struct dimension {};
+
+namespace impl
+{
+  template <int E, typename D>
+  struct prepend_exponent;
+
+  template <int E, int ... Es>
+  struct prepend_exponent<E, dimension<Es...>>
+  {
+    using type = dimension<E, Es...>;
+  };
+
+  template <typename D>
+  struct trim_dimension;
+
+  template <>
+  struct trim_dimension<dimension<>>
+  {
+    using type = dimension<>;
+  };
+
+  template <int E, int ... Es>
+  struct trim_dimension<dimension<E, Es...>>
+  {
+    using rest = typename trim_dimension<dimension<Es...>>::type;
+    using type = std::conditional_t<E == 0 && std::is_same<rest, dimension<>>::value,
+                                    dimension<>,
+                                    typename prepend_exponent<E, rest>::type>;
+  };
+
+  template <typename A, typename B>
+  struct add_dimensions;
+
+  template <int ... Bs>
+  struct add_dimensions<dimension<>, dimension<Bs...>>
+  {
+    using type = dimension<Bs...>;
+  };
+
+  template <int A, int ... As>
+  struct add_dimensions<dimension<A, As...>, dimension<>>
+  {
+    using type = dimension<A, As...>;
+  };
+
+  template <int A, int ... As, int B, int ... Bs>
+  struct add_dimensions<dimension<A, As...>, dimension<B, Bs...>>
+    : prepend_exponent<A + B, typename add_dimensions<dimension<As...>, dimension<Bs...>>::type>
+  {
+  };
+
+  template <typename D>
+  struct invert_dimension;
+
+  template <int ... Es>
+  struct invert_dimension<dimension<Es...>>
+  {
+    using type = dimension<-Es...>;
+  };
+}
+
+template <typename A, typename B>
+using dimension_multiply = typename impl::trim_dimension<
+  typename impl::add_dimensions<A, B>::type
+>::type;
+
+template <typename A, typename B>
+using dimension_divide = dimension_multiply<A, typename impl::invert_dimension<B>::type>;
+
+template <typename Dimension, typename Period = std::ratio<1>>
+struct unit;
+
+namespace impl
+{
+  template <typename Dimension, typename Period>
+  struct unit_base
+  {
+    using dimension = Dimension;
+    using period = Period;
+  };
+
+  template <typename D, typename P>
+  unit_base<D, P> unit_base_of(const unit_base<D, P>*);
+
+  template <typename S>
+  using unit_base_t = decltype(unit_base_of(static_cast<const S*>(nullptr)));
+
+  template <typename Dimension, typename Period>
+  struct unit_operators
+  {
+    template <typename T>
+    class modifier;
+  };
+
+  template <typename Dimension, typename Period>
+  struct quantity_tag;
+
+  template <typename F, typename T>
+  STRONG_CONSTEXPR
+  T
+  scale(
+    const T& t)
+  noexcept(noexcept(t * t / t))
+  {
+    return F::num == 1 && F::den == 1 ? t
+         : F::den == 1 ? t * static_cast<T>(F::num)
+         : F::num == 1 ? t / static_cast<T>(F::den)
+         : t * static_cast<T>(F::num) / static_cast<T>(F::den);
+  }
+}
+
+// The strong type for a product or quotient of strong quantities.
+template <typename Rep, typename Dimension, typename Period = std::ratio<1>>
+using quantity = type<Rep, impl::quantity_tag<Dimension, Period>, unit<Dimension, Period>>;
+
+// To, with the value of from converted to its period. The dimensions of To
+// and From must be the same. The scaling is done, like std::chrono::duration_cast,
+// in the common type of the underlying types and std::intmax_t, with the
+// ratio between the periods reduced at compile time.
+template <typename To, typename From>
+STRONG_NODISCARD
+STRONG_CONSTEXPR
+To
+unit_cast(
+  const From& from)
+noexcept(noexcept(To(static_cast<underlying_type_t<To>>(value_of(from)))))
+{
+  using to_unit = impl::unit_base_t<To>;
+  using from_unit = impl::unit_base_t<From>;
+  static_assert(std::is_same<typename to_unit::dimension, typename from_unit::dimension>::value,
+                "strong::unit_cast between different dimensions");
+  using factor = std::ratio_divide<typename from_unit::period, typename to_unit::period>;
+  using common = std::common_type_t<underlying_type_t<To>, underlying_type_t<From>, std::intmax_t>;
+  return To(static_cast<underlying_type_t<To>>(
+    impl::scale<factor>(static_cast<common>(value_of(from)))));
+}
+
+namespace impl
+{
+  template <typename Dimension, typename Period>
+  template <typename T, typename Tag, typename ... M>
+  class unit_operators<Dimension, Period>::modifier<::strong::type<T, Tag, M...>>
+    : public unit_base<Dimension, Period>
+  {
+    using type = ::strong::type<T, Tag, M...>;
+  public:
+    template <typename U, typename UU = unit_base_t<U>>
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    quantity<decltype(std::declval<const T&>() * std::declval<const underlying_type_t<U>&>()),
+             dimension_multiply<Dimension, typename UU::dimension>,
+             std::ratio_multiply<Period, typename UU::period>>
+    operator*(
+      const type& lh,
+      const U& rh)
+    noexcept(noexcept(value_of(lh) * value_of(rh)))
+    {
+      using result = quantity<decltype(value_of(lh) * value_of(rh)),
+                              dimension_multiply<Dimension, typename UU::dimension>,
+                              std::ratio_multiply<Period, typename UU::period>>;
+      return result{value_of(lh) * value_of(rh)};
+    }
+
+    // A strong::unit is also a strong::difference, so the quotient of two
+    // values of the same type is a value of the underlying type.
+    template <typename U,
+              typename UU = unit_base_t<U>,
+              typename = std::enable_if_t<!std::is_same<U, type>::value>>
+    STRONG_NODISCARD
+    friend
+    STRONG_CONSTEXPR
+    quantity<decltype(std::declval<const T&>() / std::declval<const underlying_type_t<U>&>()),
+             dimension_divide<Dimension, typename UU::dimension>,
+             std::ratio_divide<Period, typename UU::period>>
+    operator/(
+      const type& lh,
+      const U& rh)
+    noexcept(noexcept(value_of(lh) / value_of(rh)))
+    {
+      using result = quantity<decltype(value_of(lh) / value_of(rh)),
+                              dimension_divide<Dimension, typename UU::dimension>,
+                              std::ratio_divide<Period, typename UU::period>>;
+      return result{value_of(lh) / value_of(rh)};
+    }
+  };
+}
+
+// A strong::difference with strong::equality, and a dimension and a period,
+// in the spirit of std::chrono::duration. Products and quotients of strong values with units
+// are strong::quantity<> types with the resulting dimension and period, and
+// strong::unit_cast<> converts between types with the same dimension.
+template <typename Dimension, typename Period>
+struct unit
+{
+  using dimension = typename impl::trim_dimension<Dimension>::type;
+  using period = typename Period::type;
+
+  template <typename>
+  using expands_to = impl::modifier_list<difference, equality, impl::unit_operators<dimension, period>>;
+
+  template <typename T>
+  class modifier
+    : public difference::modifier<T>
+    , public equality::modifier<T>
+    , public impl::unit_operators<dimension, period>::template modifier<T>
+  {
+  };
+};
+
+#if STRONG_HAS_CONCEPTS
+template <typename T>
+concept unit_type = strong_type<T> && requires { typename impl::unit_base_t<T>; };
+#endif
+
+}
+#endif //ROLLBEAR_STRONG_TYPE_UNIT_HPP_INCLUDED
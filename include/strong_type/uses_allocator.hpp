@@ -0,0 +1,42 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+#ifndef ROLLBEAR_STRONG_TYPE_USES_ALLOCATOR_HPP_INCLUDED
+#define ROLLBEAR_STRONG_TYPE_USES_ALLOCATOR_HPP_INCLUDED
+
+#include "type.hpp"
+
+#include <memory>
+
+// Makes strong types of allocator aware underlying types allocator aware,
+// with uses-allocator construction from std::allocator_arg. Include it before
+// strong types are used with allocators.
+
+namespace strong
+{
+
+namespace impl
+{
+  template <>
+  struct is_allocator_arg<std::allocator_arg_t> : std::true_type {};
+}
+
+}
+
+namespace std {
+template <typename T, typename Tag, typename ... M, typename A>
+struct uses_allocator<::strong::type<T, Tag, M...>, A> : uses_allocator<T, A>
+{
+};
+}
+#endif //ROLLBEAR_STRONG_TYPE_USES_ALLOCATOR_HPP_INCLUDED
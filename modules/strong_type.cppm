@@ -0,0 +1,47 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+// The C++20 named module strong_type, with everything in
+// <strong_type/strong_type.hpp>. The header is the primary interface, and
+// this unit only exports it.
+
+module;
+
+// Every standard library header that strong_type.hpp includes must be
+// included here, in the global module fragment, so that they are not
+// attached to the module when the header is included below.
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <ostream>
+#include <ratio>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+export module strong_type;
+
+export extern "C++" {
+#include "strong_type/strong_type.hpp"
+}
@@ -15,12 +15,29 @@
 // include first to ensure there aren't any unmet header dependencies
 #include <strong_type/strong_type.hpp>
 
+#include <strong_type/atomic.hpp>
+#include <strong_type/fixed_point.hpp>
+#include <strong_type/fixed_string.hpp>
+#include <strong_type/id_generator.hpp>
+#include <strong_type/interned.hpp>
+#include <strong_type/per_thread_array.hpp>
+#include <strong_type/seqlock.hpp>
+#include <strong_type/sharded_counter.hpp>
+#include <strong_type/tagged_ptr.hpp>
+#if defined(__unix__) || defined(__APPLE__)
+#include <strong_type/mapped_array.hpp>
+#endif
+
+#include <cstdio>
+#include <cstring>
 #include <iomanip>
 #include <unordered_set>
 #include <memory>
 #include <algorithm>
 #include <vector>
+#include <array>
 #include <sstream>
+#include <thread>
 
 #include <catch.hpp>
 
@@ -672,6 +689,150 @@ TEST_CASE("an iostreamable type can be both read and written using streams")
   REQUIRE(os.str() == "3");
 }
 
+#if STRONG_HAS_CHARCONV
+TEST_CASE("a parsable type can be read using from_chars")
+{
+  using T = strong::type<int, struct i_, strong::parsable>;
+  T i{0};
+
+  const char s[] = "123 4";
+  auto r = from_chars(s, s + 5, i);
+  REQUIRE(r.ec == std::errc{});
+  REQUIRE(r.ptr == s + 3);
+  REQUIRE(value_of(i) == 123);
+
+  const char h[] = "ff";
+  r = from_chars(h, h + 2, i, 16);
+  REQUIRE(r.ec == std::errc{});
+  REQUIRE(value_of(i) == 255);
+
+  r = from_chars(s + 3, s + 5, i);
+  REQUIRE(r.ec == std::errc::invalid_argument);
+  REQUIRE(value_of(i) == 255);
+}
+
+TEST_CASE("parse_delimited parses all fields of a buffer")
+{
+  using T = strong::type<unsigned, struct i_, strong::parsable>;
+  std::vector<T> v;
+
+  auto r = strong::parse_delimited<T>("3,1,4,", ',', std::back_inserter(v));
+  REQUIRE(r.ec == std::errc{});
+  REQUIRE(v.size() == 3U);
+  REQUIRE(value_of(v[0]) == 3U);
+  REQUIRE(value_of(v[1]) == 1U);
+  REQUIRE(value_of(v[2]) == 4U);
+}
+
+TEST_CASE("parse_delimited reports the position of a malformed field")
+{
+  using T = strong::type<unsigned, struct i_, strong::parsable>;
+  std::vector<T> v;
+
+  std::string_view text = "3\n1x\n4";
+  auto r = strong::parse_delimited<T>(text, '\n', std::back_inserter(v));
+  REQUIRE(r.ec == std::errc::invalid_argument);
+  REQUIRE(r.ptr == text.data() + 3);
+  REQUIRE(v.size() == 1U);
+
+  r = strong::parse_delimited<T>("3,,4", ',', std::back_inserter(v));
+  REQUIRE(r.ec == std::errc::invalid_argument);
+  REQUIRE(v.size() == 2U);
+
+  r = strong::parse_delimited<T>("99999999999", ',', std::back_inserter(v));
+  REQUIRE(r.ec == std::errc::result_out_of_range);
+}
+#endif
+
+TEST_CASE("a serializable type is written and read in its byte order")
+{
+  using B = strong::type<uint32_t, struct b_, strong::serializable<strong::endian::big>>;
+  using L = strong::type<uint32_t, struct l_, strong::serializable<strong::endian::little>>;
+
+  unsigned char buf[8];
+  B b{0x01020304U};
+  L l{0x01020304U};
+  REQUIRE(b.write_to(buf) == buf + 4);
+  REQUIRE(l.write_to(buf + 4) == buf + 8);
+  const unsigned char expected[] = { 1, 2, 3, 4, 4, 3, 2, 1 };
+  REQUIRE(std::equal(std::begin(buf), std::end(buf), std::begin(expected)));
+
+  B rb{0U};
+  L rl{0U};
+  const unsigned char* p = buf;
+  p = rb.read_from(p);
+  p = rl.read_from(p);
+  REQUIRE(p == buf + 8);
+  REQUIRE(value_of(rb) == 0x01020304U);
+  REQUIRE(value_of(rl) == 0x01020304U);
+}
+
+TEST_CASE("arrays of serializable types round trip in bulk")
+{
+  using B = strong::type<uint16_t, struct b_, strong::serializable<strong::endian::big>>;
+  using L = strong::type<uint16_t, struct l_, strong::serializable<strong::endian::little>>;
+
+  const B bs[] = { B{uint16_t(0x0102)}, B{uint16_t(0x0304)} };
+  const L ls[] = { L{uint16_t(0x0102)}, L{uint16_t(0x0304)} };
+  char buf[8];
+  REQUIRE(strong::serialize(bs, 2, buf) == buf + 4);
+  REQUIRE(strong::serialize(ls, 2, buf + 4) == buf + 8);
+  const char expected[] = { 1, 2, 3, 4, 2, 1, 4, 3 };
+  REQUIRE(std::equal(std::begin(buf), std::end(buf), std::begin(expected)));
+
+  std::vector<B> rbs(2, B{uint16_t{}});
+  std::vector<L> rls(2, L{uint16_t{}});
+  REQUIRE(strong::deserialize(buf, 2, rbs.data()) == buf + 4);
+  REQUIRE(strong::deserialize(buf + 4, 2, rls.data()) == buf + 8);
+  REQUIRE(value_of(rbs[0]) == 0x0102U);
+  REQUIRE(value_of(rbs[1]) == 0x0304U);
+  REQUIRE(value_of(rls[0]) == 0x0102U);
+  REQUIRE(value_of(rls[1]) == 0x0304U);
+}
+
+TEST_CASE("big_endian and little_endian store the bytes in their order")
+{
+  using B = strong::type<strong::big_endian<uint32_t>, struct b_, strong::equality, strong::ordered>;
+  using L = strong::type<strong::little_endian<uint16_t>, struct l_, strong::arithmetic>;
+  static_assert(sizeof(B) == 4U && alignof(B) == 1U, "");
+  static_assert(sizeof(L) == 2U && alignof(L) == 1U, "");
+  static_assert(std::is_trivially_copyable<B>{}, "");
+  static_assert(std::is_nothrow_constructible<B, strong::uninitialized_t>{}, "");
+
+  struct header
+  {
+    B seq;
+    L len;
+  };
+  static_assert(sizeof(header) == 6U, "");
+  const unsigned char wire[] = { 0, 0, 1, 2, 3, 4 };
+  header h{B{strong::uninitialized}, L{strong::uninitialized}};
+  std::memcpy(&h, wire, sizeof(h));
+  REQUIRE(value_of(h.seq) == 0x102U);
+  REQUIRE(value_of(h.len) == 0x403U);
+  REQUIRE(h.seq == B{0x102U});
+  REQUIRE(h.seq < B{0x103U});
+
+  h.len += L{uint16_t(1)};
+  REQUIRE(value_of(h.len) == 0x404U);
+  REQUIRE(value_of(h.len * L{uint16_t(2)}) == 0x808U);
+  value_of(h.seq) = 0x01020304U;
+  unsigned char out[sizeof(h)];
+  std::memcpy(out, &h, sizeof(h));
+  const unsigned char expected[] = { 1, 2, 3, 4, 4, 4 };
+  REQUIRE(std::equal(std::begin(out), std::end(out), std::begin(expected)));
+}
+
+TEST_CASE("endian_storage is hashable")
+{
+  using H = strong::type<strong::big_endian<int>, struct h_, strong::hashable, strong::equality>;
+  std::unordered_set<H> s;
+  s.insert(H{3});
+  s.insert(H{3});
+  s.insert(H{4});
+  REQUIRE(s.size() == 2U);
+}
+
 TEST_CASE("an incrementable can be incremented")
 {
   using C = strong::type<int, struct i_, strong::incrementable>;
@@ -1169,4 +1330,1176 @@ TEST_CASE("ordered_with")
   REQUIRE_FALSE(i1 > 1);
   REQUIRE(2 > i1);
   REQUIRE_FALSE(1 > i1);
-}
\ No newline at end of file
+}
+
+namespace {
+using qty = strong::type<int, struct qty_, strong::equality>;
+using notional = strong::type<double, struct notional_, strong::equality>;
+using unit_price = strong::type<double, struct unit_price_, strong::equality,
+                                strong::arithmetic_with<strong::times<qty, notional>,
+                                                        strong::divided_by<qty, double>>>;
+using offset = strong::type<int, struct offset_, strong::equality, strong::arithmetic_with<int>>;
+}
+
+static_assert(std::is_same<multiply<unit_price, qty>, notional>{}, "");
+static_assert(std::is_same<multiply<qty, unit_price>, notional>{}, "");
+static_assert(std::is_same<divide<unit_price, qty>, double>{}, "");
+static_assert(!is_multipliable<qty, notional>{}, "");
+static_assert(!is_divisible<qty, unit_price>{}, "");
+static_assert(!is_detected<add, unit_price, qty>{}, "");
+static_assert(std::is_same<add<offset, int>, offset>{}, "");
+static_assert(std::is_same<add<int, offset>, offset>{}, "");
+static_assert(!is_detected<add, offset, offset>{}, "");
+static_assert(!is_detected<add, offset, unit_price>{}, "");
+static_assert(value_of(unit_price{2.5} * qty{4}) == 10.0, "");
+
+TEST_CASE("arithmetic_with")
+{
+  offset o{3};
+  REQUIRE(o + 2 == offset{5});
+  REQUIRE(2 + o == offset{5});
+  REQUIRE(o - 2 == offset{1});
+  REQUIRE(o * 2 == offset{6});
+  REQUIRE(2 * o == offset{6});
+  REQUIRE(o / 3 == offset{1});
+  o += 4;
+  REQUIRE(o == offset{7});
+  o -= 1;
+  o *= 2;
+  o /= 3;
+  REQUIRE(o == offset{4});
+  REQUIRE(unit_price{2.5} * qty{4} == notional{10.0});
+  REQUIRE(unit_price{9} / qty{3} == 3.0);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_CASE("a mapped_array maps the elements written to a file")
+{
+  using id = strong::type<uint64_t, struct mapped_id_, strong::equality>;
+  const std::string path = "strong_type_mapped_array_test.bin";
+  const id ids[] = { id{3U}, id{1U}, id{4U}, id{1U}, id{5U} };
+  strong::write_mapped_array(path, ids, 5);
+
+  {
+    strong::mapped_array<id> a(path);
+    REQUIRE(a.size() == 5U);
+    REQUIRE(std::equal(a.begin(), a.end(), std::begin(ids)));
+    auto v = a.view();
+    static_assert(is_range<decltype(v)>{}, "");
+    static_assert(is_indexable<decltype(v), int>{}, "");
+    REQUIRE(v[2] == id{4U});
+    REQUIRE(std::count(v.begin(), v.end(), id{1U}) == 2);
+    REQUIRE_THROWS_AS(a.mutable_view(), std::logic_error);
+  }
+  {
+    strong::mapped_array<id> a(path, strong::map_mode::copy_on_write);
+    auto v = a.mutable_view();
+    v[0] = id{9U};
+    REQUIRE(a[0] == id{9U});
+    strong::mapped_array<id> b(path);
+    REQUIRE(b[0] == id{3U});
+  }
+  std::remove(path.c_str());
+}
+
+TEST_CASE("a mapped_array rejects files written for another type")
+{
+  using id = strong::type<uint64_t, struct mapped_id_>;
+  using other = strong::type<uint64_t, struct mapped_other_>;
+  const std::string path = "strong_type_mapped_array_test.bin";
+  const id ids[] = { id{3U} };
+  strong::write_mapped_array(path, ids, 1);
+
+  REQUIRE_NOTHROW(strong::mapped_array<id>(path));
+  REQUIRE_THROWS_AS(strong::mapped_array<other>(path), strong::mapped_array_error);
+  std::remove(path.c_str());
+  REQUIRE_THROWS_AS(strong::mapped_array<id>(path), std::system_error);
+}
+
+TEST_CASE("a mapped_array rejects files written with the other byte order")
+{
+  using id = strong::type<uint64_t, struct mapped_id_>;
+  const std::string path = "strong_type_mapped_array_test.bin";
+  const id ids[] = { id{3U} };
+  strong::write_mapped_array(path, ids, 1);
+
+  {
+    std::FILE* f = std::fopen(path.c_str(), "r+b");
+    REQUIRE(f != nullptr);
+    unsigned char header[64];
+    REQUIRE(std::fread(header, 1, sizeof(header), f) == sizeof(header));
+    // version, byte order mark, identity, element size and count
+    const int widths[] = { 4, 4, 8, 8, 8 };
+    unsigned char* p = header + 8;
+    for (int w : widths)
+    {
+      std::reverse(p, p + w);
+      p += w;
+    }
+    std::fseek(f, 0, SEEK_SET);
+    REQUIRE(std::fwrite(header, 1, sizeof(header), f) == sizeof(header));
+    std::fclose(f);
+  }
+  std::string what;
+  try
+  {
+    strong::mapped_array<id> a(path);
+  }
+  catch (const strong::mapped_array_error& e)
+  {
+    what = e.what();
+  }
+  REQUIRE(what.find("different byte order") != std::string::npos);
+  std::remove(path.c_str());
+}
+#endif
+
+template <typename T>
+using fetch_adding = decltype(std::declval<T&>().fetch_add(std::declval<typename T::value_type>()));
+
+template <typename T>
+using fetch_anding = decltype(std::declval<T&>().fetch_and(std::declval<typename T::value_type>()));
+
+template <typename T>
+using fetch_maxing = decltype(std::declval<T&>().fetch_max(std::declval<typename T::value_type>()));
+
+static_assert(is_detected<fetch_adding, strong::atomic<ahandle>>{}, "");
+static_assert(is_detected<fetch_adding, strong::atomic<uhandle>>{}, "");
+static_assert(!is_detected<fetch_adding, strong::atomic<handle>>{}, "");
+static_assert(!is_detected<fetch_anding, strong::atomic<ahandle>>{}, "");
+static_assert(is_detected<fetch_anding, strong::atomic<strong::type<unsigned, struct ba_, strong::bitarithmetic>>>{}, "");
+static_assert(is_detected<fetch_maxing, strong::atomic<uhandle>>{}, "");
+static_assert(!is_detected<fetch_maxing, strong::atomic<ahandle>>{}, "");
+static_assert(!is_incrementable<strong::atomic<handle>>{}, "");
+static_assert(is_incrementable<strong::atomic<strong::type<int, struct ai_, strong::incrementable>>>{}, "");
+static_assert(sizeof(strong::atomic<handle>) == sizeof(std::atomic<int>), "");
+static_assert(std::is_nothrow_default_constructible<strong::atomic<handle>>{}, "");
+static_assert(!std::is_copy_constructible<strong::atomic<handle>>{}, "");
+#if __cplusplus >= 201703L
+static_assert(strong::atomic<handle>::is_always_lock_free == std::atomic<int>::is_always_lock_free, "");
+#endif
+
+TEST_CASE("a strong::atomic loads, stores and exchanges strong values")
+{
+  using T = strong::type<int, struct t_, strong::equality>;
+  strong::atomic<T> a{T{3}};
+  REQUIRE(a.load() == T{3});
+  a.store(T{4}, std::memory_order_release);
+  REQUIRE(a.load(std::memory_order_acquire) == T{4});
+  REQUIRE(a.exchange(T{5}) == T{4});
+  T expected{4};
+  REQUIRE_FALSE(a.compare_exchange_strong(expected, T{6}));
+  REQUIRE(expected == T{5});
+  REQUIRE(a.compare_exchange_strong(expected, T{6}, std::memory_order_acq_rel, std::memory_order_acquire));
+  REQUIRE(T(a) == T{6});
+}
+
+TEST_CASE("a strong::atomic has the operations its modifiers allow")
+{
+  using T = strong::type<unsigned, struct t_, strong::arithmetic, strong::bitarithmetic,
+                         strong::ordered, strong::bicrementable>;
+  strong::atomic<T> a{T{3U}};
+  REQUIRE(value_of(a.fetch_add(T{2U})) == 3U);
+  REQUIRE(value_of(a.fetch_sub(T{1U}, std::memory_order_relaxed)) == 5U);
+  REQUIRE(value_of(a.fetch_or(T{8U})) == 4U);
+  REQUIRE(value_of(a.fetch_and(T{9U})) == 12U);
+  REQUIRE(value_of(a.fetch_xor(T{1U})) == 8U);
+  REQUIRE(value_of(a.fetch_max(T{7U})) == 9U);
+  REQUIRE(value_of(a.load()) == 9U);
+  REQUIRE(value_of(a.fetch_max(T{11U})) == 9U);
+  REQUIRE(value_of(a.fetch_min(T{2U})) == 11U);
+  REQUIRE(value_of(++a) == 3U);
+  REQUIRE(value_of(a++) == 3U);
+  REQUIRE(value_of(--a) == 3U);
+  REQUIRE(value_of(a--) == 3U);
+  REQUIRE(value_of(a.load()) == 2U);
+}
+
+TEST_CASE("a strong::atomic can be incremented from many threads")
+{
+  using T = strong::type<long, struct t_, strong::difference>;
+  strong::atomic<T> a{T{0}};
+  std::vector<std::thread> threads;
+  for (int t = 0; t != 4; ++t)
+  {
+    threads.emplace_back([&a]{
+      for (int i = 0; i != 10000; ++i) a.fetch_add(T{1}, std::memory_order_relaxed);
+    });
+  }
+  for (auto& t : threads) t.join();
+  REQUIRE(value_of(a.load()) == 40000);
+}
+
+#if defined(__cpp_lib_atomic_ref)
+TEST_CASE("a strong::atomic_ref operates on a strong value in place")
+{
+  using T = strong::type<int, struct t_, strong::arithmetic, strong::ordered>;
+  T values[] = { T{1}, T{2} };
+  strong::atomic_ref<T> r{values[1]};
+  REQUIRE(value_of(r.fetch_add(T{3})) == 2);
+  REQUIRE(value_of(r.fetch_max(T{4})) == 5);
+  r = T{7};
+  REQUIRE(value_of(values[1]) == 7);
+  REQUIRE(value_of(values[0]) == 1);
+  const strong::atomic_ref<T> c{values[0]};
+  T expected{1};
+  REQUIRE(c.compare_exchange_strong(expected, T{8}));
+  REQUIRE(value_of(c.exchange(T{9})) == 8);
+  c.store(T{10});
+  REQUIRE(value_of(c.load()) == 10);
+}
+#endif
+
+using cahandle = strong::type<uint64_t, struct ca_, strong::cache_aligned, strong::arithmetic>;
+static_assert(alignof(cahandle) == STRONG_CACHE_LINE_SIZE, "");
+static_assert(sizeof(cahandle) == STRONG_CACHE_LINE_SIZE, "");
+static_assert(std::is_trivially_copyable<cahandle>{}, "");
+static_assert(std::is_arithmetic<cahandle>{}, "");
+
+TEST_CASE("cache_aligned values are in separate cache lines")
+{
+  cahandle a[2] = { cahandle{1U}, cahandle{2U} };
+  auto distance = reinterpret_cast<const char*>(&a[1]) - reinterpret_cast<const char*>(&a[0]);
+  REQUIRE(distance == STRONG_CACHE_LINE_SIZE);
+  REQUIRE(value_of(a[0] + a[1]) == 3U);
+}
+
+TEST_CASE("per_thread_array elements are in separate cache lines")
+{
+  using T = strong::type<uint64_t, struct t_, strong::arithmetic>;
+  strong::per_thread_array<T> a(T{0U}, 4);
+  REQUIRE(a.size() == 4U);
+  for (std::size_t i = 0; i != a.size(); ++i)
+  {
+    REQUIRE(reinterpret_cast<std::uintptr_t>(&a[i]) % STRONG_CACHE_LINE_SIZE == 0U);
+  }
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t != 4; ++t)
+  {
+    threads.emplace_back([&a]{
+      for (int i = 0; i != 1000; ++i) a.local() += T{1U};
+    });
+  }
+  for (auto& t : threads) t.join();
+  T sum{0U};
+  a.for_each([&](const T& v) { sum += v; });
+  REQUIRE(value_of(sum) == 4000U);
+}
+
+TEST_CASE("per_thread_array indexes are reused when threads exit")
+{
+  using T = strong::type<uint64_t, struct t_, strong::arithmetic>;
+  strong::per_thread_array<T> a(T{0U}, 2);
+  T* main_local = &a.local();
+  std::vector<T*> locals;
+  for (int t = 0; t != 4; ++t)
+  {
+    std::thread([&]{ locals.push_back(&a.local()); }).join();
+  }
+  REQUIRE(std::count(locals.begin(), locals.end(), locals.front()) == 4);
+  REQUIRE(locals.front() != main_local);
+  REQUIRE_THROWS_AS(strong::per_thread_array<T>(T{0U}, 0), std::invalid_argument);
+}
+
+TEST_CASE("per_thread_array elements can be atomic")
+{
+  using T = strong::type<uint64_t, struct t_, strong::arithmetic>;
+  strong::per_thread_array<strong::atomic<T>> a(T{0U});
+  REQUIRE(a.size() == strong::per_thread_array<T>::default_size());
+  a.local().fetch_add(T{2U});
+  T sum{0U};
+  a.for_each([&](const strong::atomic<T>& v) { sum += v.load(); });
+  REQUIRE(value_of(sum) == 2U);
+}
+
+template <typename T>
+using add_assigning = decltype(std::declval<T&>() += std::declval<typename T::value_type>());
+
+static_assert(is_detected<add_assigning, strong::sharded_counter<ahandle>>{}, "");
+static_assert(!is_incrementable<strong::sharded_counter<ahandle>>{}, "");
+static_assert(!is_detected<add_assigning, strong::sharded_counter<strong::type<int, struct sci_, strong::incrementable>>>{}, "");
+static_assert(is_incrementable<strong::sharded_counter<strong::type<int, struct sci_, strong::incrementable>>>{}, "");
+static_assert(!is_decrementable<strong::sharded_counter<strong::type<int, struct sci_, strong::incrementable>>>{}, "");
+
+TEST_CASE("a sharded_counter sums the updates from all threads")
+{
+  using bytes = strong::type<uint64_t, struct bytes_, strong::arithmetic>;
+  using count = strong::type<int, struct count_, strong::bicrementable>;
+  for (int n = 1; n <= 4; ++n)
+  {
+    strong::sharded_counter<bytes> sent(4);
+    strong::sharded_counter<count> orders(2);
+    std::vector<std::thread> threads;
+    for (int t = 0; t != n; ++t)
+    {
+      threads.emplace_back([&]{
+        for (int i = 0; i != 1000; ++i)
+        {
+          sent += bytes{3U};
+          ++orders;
+        }
+        --orders;
+      });
+    }
+    for (auto& t : threads) t.join();
+    bytes b = sent;
+    REQUIRE(value_of(b) == 3000U * unsigned(n));
+    REQUIRE(value_of(orders.load()) == 999 * n);
+    sent -= bytes{1U};
+    REQUIRE(value_of(sent.load()) == 3000U * unsigned(n) - 1U);
+    sent.reset();
+    REQUIRE(value_of(sent.load()) == 0U);
+  }
+}
+
+using order_id = strong::type<uint64_t, struct order_id_, strong::incrementable, strong::ordered, strong::hashable, strong::equality>;
+#if defined(__cpp_constinit)
+constinit
+#endif
+static strong::id_generator<order_id> order_ids{order_id{1U}, 16};
+
+TEST_CASE("an id_generator mints unique ids, monotonic per thread")
+{
+  constexpr int threads = 4;
+  constexpr int count = 1000;
+  std::vector<std::vector<order_id>> ids(threads);
+  std::vector<std::thread> workers;
+  for (int t = 0; t != threads; ++t)
+  {
+    workers.emplace_back([&ids, t]{
+      for (int i = 0; i != count; ++i) ids[std::size_t(t)].push_back(order_ids.next());
+    });
+  }
+  for (auto& w : workers) w.join();
+  std::unordered_set<order_id> all;
+  for (auto& v : ids)
+  {
+    REQUIRE(std::is_sorted(v.begin(), v.end()));
+    all.insert(v.begin(), v.end());
+  }
+  REQUIRE(all.size() == std::size_t(threads * count));
+}
+
+TEST_CASE("id_generators do not share blocks")
+{
+  auto a = std::make_unique<strong::id_generator<order_id>>(order_id{100U}, 10);
+  REQUIRE(a->next() == order_id{100U});
+  a = std::make_unique<strong::id_generator<order_id>>(order_id{200U}, 10);
+  REQUIRE(a->next() == order_id{200U});
+  REQUIRE(a->next() == order_id{201U});
+  REQUIRE_THROWS_AS(strong::id_generator<order_id>(order_id{1U}, 0), std::invalid_argument);
+}
+
+TEST_CASE("id_generators used alternately in a thread keep their blocks")
+{
+  strong::id_generator<order_id> a{order_id{100U}, 10};
+  strong::id_generator<order_id> b{order_id{200U}, 10};
+  for (unsigned i = 0; i != 5; ++i)
+  {
+    REQUIRE(a.next() == order_id{100U + i});
+    REQUIRE(b.next() == order_id{200U + i});
+  }
+}
+
+TEST_CASE("a globally_monotonic id_generator mints ids in order")
+{
+  strong::id_generator<order_id> g{order_id{5U}, strong::globally_monotonic};
+  REQUIRE(g.next() == order_id{5U});
+  REQUIRE(g.next() == order_id{6U});
+}
+
+namespace {
+struct stack_node
+{
+  int value;
+  stack_node* next;
+};
+using node_ptr = strong::tagged_ptr<stack_node, struct node_ptr_, STRONG_TAGGED_PTR_HIGH_BITS == 0 ? 3 : 16>;
+}
+
+static_assert(sizeof(node_ptr) == sizeof(void*), "");
+static_assert(std::is_trivially_copyable<node_ptr>::value, "");
+static_assert(strong::type_is<node_ptr, strong::pointer>::value, "");
+#if __cplusplus >= 201703L
+static_assert(strong::atomic<node_ptr>::is_always_lock_free, "");
+#endif
+
+TEST_CASE("a tagged_ptr is a pointer with a tag")
+{
+  stack_node n{3, nullptr};
+  node_ptr p{&n, 5U};
+  REQUIRE(p.get() == &n);
+  REQUIRE(p.tag() == 5U);
+  REQUIRE((*p).value == 3);
+  REQUIRE(p->value == 3);
+  REQUIRE(p != nullptr);
+  REQUIRE(p.with_tag(6U).get() == &n);
+  REQUIRE(p.with_tag(6U) != p);
+  REQUIRE(p.with_tag(5U) == p);
+  node_ptr last{&n, strong::underlying_type_t<node_ptr>::tag_mask};
+  REQUIRE(last.with_next_tag(nullptr).tag() == 0U);
+  REQUIRE(last.with_next_tag(nullptr) == nullptr);
+}
+
+namespace {
+struct pool_node
+{
+  std::atomic<pool_node*> next{nullptr};
+  std::atomic<bool> held{false};
+};
+using pool_ptr = strong::tagged_ptr<pool_node, struct pool_ptr_, STRONG_TAGGED_PTR_HIGH_BITS == 0 ? 3 : 16>;
+}
+
+TEST_CASE("a lock free stack with an atomic tagged_ptr top recycles nodes")
+{
+  // Few nodes, popped and pushed back in a different order by all threads,
+  // so the same address is often back on top between the load and the
+  // compare exchange of a pop. Without the tag, such a pop would install a
+  // next pointer to a node another thread holds.
+  constexpr int threads = 4;
+  constexpr int rounds = 20000;
+  constexpr std::size_t pool = 2 * threads;
+  std::vector<pool_node> nodes(pool);
+  strong::atomic<pool_ptr> top{pool_ptr{nullptr}};
+  auto push = [&top](pool_node* n) {
+    auto t = top.load();
+    do { n->next.store(t.get(), std::memory_order_relaxed); } while (!top.compare_exchange_weak(t, t.with_next_tag(n)));
+  };
+  // Yields between reading the next pointer and the compare exchange, to
+  // let other threads recycle the node in between also on a single core.
+  auto pop = [&top]() -> pool_node* {
+    auto t = top.load();
+    while (t != nullptr)
+    {
+      auto next = t.with_next_tag(t->next.load(std::memory_order_relaxed));
+      std::this_thread::yield();
+      if (top.compare_exchange_weak(t, next)) break;
+    }
+    return t.get();
+  };
+  for (auto& n : nodes) push(&n);
+  std::atomic<int> errors{0};
+  auto take = [&errors](pool_node* n) {
+    if (n == nullptr || n->held.exchange(true)) ++errors;
+  };
+  auto give = [&push](pool_node* n) {
+    if (n == nullptr) return;
+    n->held.store(false);
+    push(n);
+  };
+  std::vector<std::thread> workers;
+  for (int t = 0; t != threads; ++t)
+  {
+    workers.emplace_back([&]{
+      for (int i = 0; i != rounds; ++i)
+      {
+        auto a = pop();
+        take(a);
+        auto b = pop();
+        take(b);
+        give(a);
+        give(b);
+      }
+    });
+  }
+  for (auto& w : workers) w.join();
+  REQUIRE(errors == 0);
+  std::unordered_set<pool_node*> popped;
+  for (std::size_t i = 0; i != pool; ++i) popped.insert(pop());
+  REQUIRE(top.load() == nullptr);
+  REQUIRE(popped.count(nullptr) == 0U);
+  REQUIRE(popped.size() == pool);
+}
+
+TEST_CASE("a seqlock publishes a strong value")
+{
+  using price = strong::type<double, struct price_, strong::equality>;
+  strong::seqlock<price> s{price{1.5}};
+  REQUIRE(s.load() == price{1.5});
+  s.store(price{2.5});
+  price p{0.0};
+  REQUIRE(s.try_load(p));
+  REQUIRE(p == price{2.5});
+}
+
+namespace {
+struct grid_point
+{
+  int x = 0;
+  int y = 0;
+};
+}
+
+TEST_CASE("a seqlock publishes a strong value with a non trivial default constructor")
+{
+  using point = strong::type<grid_point, struct point_, strong::default_constructible>;
+  strong::seqlock<point> s{point{grid_point{1, 2}}};
+  s.store(point{grid_point{3, 4}});
+  REQUIRE(value_of(s.load()).x == 3);
+  REQUIRE(value_of(s.load()).y == 4);
+}
+
+TEST_CASE("a seqlock with several fields is never read torn")
+{
+  using bid = strong::type<int64_t, struct bid_, strong::equality>;
+  using ask = strong::type<int64_t, struct ask_, strong::equality>;
+  using seq = strong::type<int16_t, struct seq_, strong::equality>;
+  strong::seqlock<bid, ask, seq> s{bid{0}, ask{0}, seq{0}};
+  static_assert(std::is_same<decltype(s.load()), std::tuple<bid, ask, seq>>{}, "");
+  std::atomic<bool> done{false};
+  std::thread writer([&]{
+    for (int64_t i = 1; i != 20000; ++i)
+    {
+      s.store(bid{i}, ask{-i}, seq{int16_t(i)});
+    }
+    done = true;
+  });
+  bool consistent = true;
+  while (!done)
+  {
+    auto v = s.load();
+    const auto b = value_of(std::get<0>(v));
+    consistent = consistent
+                 && value_of(std::get<1>(v)) == -b
+                 && value_of(std::get<2>(v)) == int16_t(b);
+  }
+  writer.join();
+  REQUIRE(consistent);
+  REQUIRE(s.load() == std::make_tuple(bid{19999}, ask{-19999}, seq{int16_t(19999)}));
+}
+
+using overlapping = strong::type<int, struct overlapping_, strong::regular, strong::equality, strong::bicrementable, strong::incrementable, strong::difference, strong::ordered>;
+static_assert(sizeof(overlapping) == sizeof(int), "");
+static_assert(is_equal_comparable<overlapping>{}, "");
+static_assert(is_less_than_comparable<overlapping>{}, "");
+static_assert(std::is_default_constructible<overlapping>{}, "");
+static_assert(strong::type_is<overlapping, strong::regular>::value, "");
+static_assert(strong::type_is<overlapping, strong::semiregular>::value, "");
+static_assert(strong::type_is<overlapping, strong::difference>::value, "");
+static_assert(!strong::type_is<overlapping, strong::iostreamable>::value, "");
+static_assert(!strong::type_is<strong::type<int, struct eq_, strong::equality>, strong::regular>::value, "");
+
+using ra_iterator = strong::type<int*, struct ra_iterator_, strong::iterator, strong::ordered, strong::equality>;
+static_assert(strong::type_is<ra_iterator, strong::iterator>::value, "");
+static_assert(strong::type_is<ra_iterator, strong::indexed<>>::value, "");
+static_assert(std::is_same<std::iterator_traits<ra_iterator>::iterator_category, std::random_access_iterator_tag>{}, "");
+
+TEST_CASE("repeated modifiers are applied once")
+{
+  overlapping a{1};
+  overlapping b{2};
+  REQUIRE(a < b);
+  REQUIRE(++a == b);
+  REQUIRE(b - a == overlapping{0});
+  int arr[] = {1, 2, 3};
+  ra_iterator i{arr};
+  REQUIRE(i[2] == 3);
+  REQUIRE(*++i == 2);
+}
+
+#if STRONG_HAS_CONCEPTS
+namespace {
+template <strong::arithmetic_type A>
+A twice(const A& a) { return a + a; }
+template <typename T>
+int twice(const T&) { return 0; }
+}
+
+static_assert(strong::strong_type<overlapping>);
+static_assert(!strong::strong_type<int>);
+static_assert(strong::ordered_type<overlapping>);
+static_assert(strong::regular_type<overlapping>);
+static_assert(strong::equality_type<overlapping>);
+static_assert(!strong::arithmetic_type<overlapping>);
+static_assert(strong::type_with<overlapping, strong::difference>);
+static_assert(strong::pointer_type<ra_iterator>);
+static_assert(!strong::range_type<ra_iterator>);
+
+TEST_CASE("concepts constrain templates on modifiers")
+{
+  using meters = strong::type<int, struct meters_, strong::arithmetic, strong::equality>;
+  REQUIRE(twice(meters{2}) == meters{4});
+  REQUIRE(twice(overlapping{2}) == 0);
+}
+#endif
+
+namespace {
+// An underlying type where every operation may throw, to check that the
+// noexcept specifications of the modifiers follow the underlying type.
+struct throwing_number
+{
+  int v;
+  throwing_number(int i) noexcept(false) : v(i) {}
+  throwing_number(const throwing_number& o) noexcept(false) : v(o.v) {}
+  throwing_number(throwing_number&& o) noexcept(false) : v(o.v) {}
+  throwing_number& operator=(const throwing_number& o) noexcept(false) { v = o.v; return *this; }
+  throwing_number& operator+=(const throwing_number& o) noexcept(false) { v += o.v; return *this; }
+  throwing_number& operator-=(const throwing_number& o) noexcept(false) { v -= o.v; return *this; }
+  throwing_number& operator*=(const throwing_number& o) noexcept(false) { v *= o.v; return *this; }
+  throwing_number& operator/=(const throwing_number& o) noexcept(false) { v /= o.v; return *this; }
+  throwing_number& operator&=(const throwing_number& o) noexcept(false) { v &= o.v; return *this; }
+  throwing_number& operator|=(const throwing_number& o) noexcept(false) { v |= o.v; return *this; }
+  throwing_number& operator^=(const throwing_number& o) noexcept(false) { v ^= o.v; return *this; }
+  throwing_number& operator<<=(int c) noexcept(false) { v <<= c; return *this; }
+  throwing_number& operator>>=(int c) noexcept(false) { v >>= c; return *this; }
+  throwing_number& operator++() noexcept(false) { ++v; return *this; }
+  throwing_number& operator--() noexcept(false) { --v; return *this; }
+  throwing_number operator-() const noexcept(false) { return {-v}; }
+  throwing_number operator~() const noexcept(false) { return {~v}; }
+  throwing_number operator-(const throwing_number& o) const noexcept(false) { return {v - o.v}; }
+  throwing_number operator/(const throwing_number& o) const noexcept(false) { return {v / o.v}; }
+  bool operator==(const throwing_number& o) const noexcept(false) { return v == o.v; }
+  bool operator!=(const throwing_number& o) const noexcept(false) { return v != o.v; }
+  bool operator<(const throwing_number& o) const noexcept(false) { return v < o.v; }
+  bool operator<=(const throwing_number& o) const noexcept(false) { return v <= o.v; }
+  bool operator>(const throwing_number& o) const noexcept(false) { return v > o.v; }
+  bool operator>=(const throwing_number& o) const noexcept(false) { return v >= o.v; }
+};
+
+template <typename T>
+struct noexcept_matrix
+{
+  using num = strong::type<T, struct num_, strong::regular, strong::ordered,
+                           strong::arithmetic, strong::bitarithmetic,
+                           strong::bicrementable>;
+  using diff = strong::type<T, struct diff_, strong::difference>;
+  using point = strong::type<T, struct point_, strong::affine_point<diff>>;
+
+  static num& n() noexcept;
+  static diff& d() noexcept;
+  static point& p() noexcept;
+  static const T& t() noexcept;
+
+  template <template <bool ...> class Reduce>
+  using reduce = Reduce<
+      std::is_nothrow_copy_constructible<num>::value,
+      std::is_nothrow_move_constructible<num>::value,
+      std::is_nothrow_copy_assignable<num>::value,
+      std::is_nothrow_move_assignable<num>::value,
+      is_nothrow_swappable<num>::value,
+      noexcept(n() == n()), noexcept(n() != n()),
+      noexcept(n() < n()), noexcept(n() <= n()),
+      noexcept(n() > n()), noexcept(n() >= n()),
+      noexcept(-n()),
+      noexcept(n() + n()), noexcept(n() - n()), noexcept(n() * n()), noexcept(n() / n()),
+      noexcept(n() += n()), noexcept(n() -= n()), noexcept(n() *= n()), noexcept(n() /= n()),
+      noexcept(~n()),
+      noexcept(n() & n()), noexcept(n() | n()), noexcept(n() ^ n()),
+      noexcept(n() << 1), noexcept(n() >> 1),
+      noexcept(++n()), noexcept(n()++), noexcept(--n()), noexcept(n()--),
+      noexcept(d() + d()), noexcept(d() - d()),
+      noexcept(d() * t()), noexcept(t() * d()), noexcept(d() / t()), noexcept(d() / d()),
+      noexcept(p() - p()), noexcept(p() + d()), noexcept(d() + p()), noexcept(p() - d()),
+      noexcept(p() += d()), noexcept(p() -= d())
+  >;
+};
+}
+
+static_assert(noexcept_matrix<int>::reduce<strong::impl::all_of>::value, "");
+static_assert(!noexcept_matrix<throwing_number>::reduce<strong::impl::any_of>::value, "");
+
+namespace {
+using length = strong::dimension<1>;
+using time_ = strong::dimension<0, 1>;
+using speed = strong::dimension_divide<length, time_>;
+using meters = strong::type<double, struct meters_, strong::unit<length>>;
+using millimeters = strong::type<long long, struct millimeters_, strong::unit<length, std::milli>>;
+using seconds = strong::type<double, struct seconds_, strong::unit<time_>>;
+using meters_per_second = strong::type<double, struct mps_, strong::unit<speed>>;
+using kilometers_per_hour = strong::type<double, struct kph_, strong::unit<speed, std::ratio<1000, 3600>>>;
+
+template <typename T, typename U>
+using product = decltype(std::declval<const T&>() * std::declval<const U&>());
+template <typename T, typename U>
+using sum = decltype(std::declval<const T&>() + std::declval<const U&>());
+template <typename To, typename From>
+using unit_cast_result = decltype(strong::unit_cast<To>(std::declval<const From&>()));
+}
+
+static_assert(std::is_same<strong::dimension_multiply<length, strong::dimension<-1>>, strong::dimension<>>{}, "");
+static_assert(std::is_same<speed, strong::dimension<1, -1>>{}, "");
+static_assert(std::is_same<strong::unit<strong::dimension<1, 0>>::dimension, length>{}, "");
+static_assert(strong::type_is<meters, strong::difference>{}, "");
+static_assert(std::is_same<decltype(meters{1} / seconds{1}), strong::quantity<double, speed>>{}, "");
+static_assert(std::is_same<decltype(meters{1} * meters{1}), strong::quantity<double, strong::dimension<2>>>{}, "");
+static_assert(std::is_same<decltype(meters{1} / meters{1}), double>{}, "");
+static_assert(std::is_same<decltype(meters{1} / millimeters{1}),
+                           strong::quantity<double, strong::dimension<>, std::kilo>>{}, "");
+static_assert(!is_detected<sum, meters, seconds>{}, "");
+static_assert(!is_detected<sum, meters, millimeters>{}, "");
+static_assert(is_detected<product, meters, seconds>{}, "");
+static_assert(is_detected<unit_cast_result, millimeters, meters>{}, "");
+static_assert(value_of(strong::unit_cast<millimeters>(meters{1.5})) == 1500, "");
+static_assert(value_of(strong::unit_cast<meters>(millimeters{250})) == 0.25, "");
+
+TEST_CASE("units scale at compile time and keep their dimensions")
+{
+  constexpr auto v = strong::unit_cast<meters_per_second>(meters{100} / seconds{8});
+  static_assert(value_of(v) == 12.5, "");
+  auto kph = strong::unit_cast<kilometers_per_hour>(v);
+  REQUIRE(value_of(kph) == Approx(45.0));
+  REQUIRE(value_of(strong::unit_cast<meters_per_second>(kph)) == Approx(value_of(v)));
+  REQUIRE(v == meters_per_second{12.5});
+  meters m{3};
+  m += meters{2};
+  m = m * 2.0;
+  REQUIRE(value_of(m) == 10.0);
+  REQUIRE(value_of(strong::unit_cast<meters>(millimeters{1500}) * seconds{2}) == 3.0);
+}
+
+namespace {
+using sat8 = strong::type<int8_t, struct sat8_, strong::equality, strong::saturating_arithmetic>;
+using usat = strong::type<unsigned, struct usat_, strong::equality, strong::saturating_arithmetic>;
+using checked = strong::type<int, struct checked_, strong::equality, strong::checked_arithmetic<>>;
+using flagged = strong::type<int64_t, struct flagged_, strong::equality,
+                             strong::checked_arithmetic<strong::flag_on_overflow>>;
+}
+
+static_assert(sat8{100} + sat8{100} == sat8{127}, "");
+static_assert(sat8{-100} - sat8{100} == sat8{-128}, "");
+static_assert(sat8{-128} / sat8{-1} == sat8{127}, "");
+static_assert(-sat8{-128} == sat8{127}, "");
+static_assert(sat8{16} * sat8{-16} == sat8{-128}, "");
+static_assert(usat{1} - usat{2} == usat{0}, "");
+static_assert(checked{2} * checked{3} == checked{6}, "");
+static_assert(noexcept(sat8{1} + sat8{1}), "");
+static_assert(!noexcept(checked{1} + checked{1}), "");
+static_assert(noexcept(flagged{1} + flagged{1}), "");
+
+TEST_CASE("saturating_arithmetic clamps results that do not fit")
+{
+  usat u{std::numeric_limits<unsigned>::max() - 1};
+  u += usat{5};
+  REQUIRE(u == usat{std::numeric_limits<unsigned>::max()});
+  u *= usat{2};
+  REQUIRE(u == usat{std::numeric_limits<unsigned>::max()});
+  REQUIRE(-usat{3} == usat{0});
+
+  const sat8 a[] = { sat8{100}, sat8{-100}, sat8{1}, sat8{-128} };
+  const sat8 b[] = { sat8{100}, sat8{-100}, sat8{2}, sat8{1} };
+  sat8 out[4] = { sat8{0}, sat8{0}, sat8{0}, sat8{0} };
+  strong::saturating_add(a, b, 4, out);
+  REQUIRE(out[0] == sat8{127});
+  REQUIRE(out[1] == sat8{-128});
+  REQUIRE(out[2] == sat8{3});
+  REQUIRE(out[3] == sat8{-127});
+  strong::saturating_sub(a, b, 4, out);
+  REQUIRE(out[0] == sat8{0});
+  REQUIRE(out[1] == sat8{0});
+  REQUIRE(out[2] == sat8{-1});
+  REQUIRE(out[3] == sat8{-128});
+  strong::saturating_mul(a, b, 4, out);
+  REQUIRE(out[0] == sat8{127});
+  REQUIRE(out[1] == sat8{127});
+  REQUIRE(out[3] == sat8{-128});
+}
+
+TEST_CASE("checked_arithmetic reports overflow to its policy")
+{
+  const int max = std::numeric_limits<int>::max();
+  REQUIRE_THROWS_AS(checked{max} + checked{1}, strong::overflow_error);
+  REQUIRE_THROWS_AS(checked{-max} - checked{2}, strong::overflow_error);
+  REQUIRE_THROWS_AS(checked{max} * checked{2}, strong::overflow_error);
+  REQUIRE_THROWS_AS(checked{1} / checked{0}, strong::overflow_error);
+  REQUIRE_THROWS_AS(-checked{-max - 1}, strong::overflow_error);
+  REQUIRE(checked{max} - checked{1} == checked{max - 1});
+
+  strong::flag_on_overflow::clear();
+  flagged f{std::numeric_limits<int64_t>::max()};
+  f -= flagged{1};
+  REQUIRE_FALSE(strong::flag_on_overflow::test());
+  f += flagged{2};
+  REQUIRE(f == flagged{std::numeric_limits<int64_t>::min()});
+  REQUIRE(strong::flag_on_overflow::test_and_clear());
+  REQUIRE_FALSE(strong::flag_on_overflow::test());
+
+  const flagged a[] = { flagged{1}, flagged{std::numeric_limits<int64_t>::min()}, flagged{3} };
+  const flagged b[] = { flagged{2}, flagged{1}, flagged{4} };
+  flagged out[3] = { flagged{0}, flagged{0}, flagged{0} };
+  REQUIRE_FALSE(strong::checked_add(a, b, 3, out));
+  REQUIRE(out[2] == flagged{7});
+  REQUIRE(strong::checked_sub(a, b, 3, out));
+  REQUIRE(strong::flag_on_overflow::test_and_clear());
+  REQUIRE(out[0] == flagged{-1});
+  REQUIRE(out[2] == flagged{-1});
+
+  const checked c[] = { checked{max}, checked{1} };
+  checked cout[2] = { checked{0}, checked{0} };
+  REQUIRE_THROWS_AS(strong::checked_mul(c, c, 2, cout), strong::overflow_error);
+}
+
+namespace {
+using seqno = strong::type<uint16_t, struct seqno_, strong::equality, strong::serial_number>;
+}
+
+static_assert(std::is_same<seqno::difference_type, int16_t>{}, "");
+static_assert(seqno{65535} + 1 == seqno{0}, "");
+static_assert(seqno{2} - 3 == seqno{65535}, "");
+static_assert(seqno{3} - seqno{65534} == 5, "");
+static_assert(seqno{65534} - seqno{3} == -5, "");
+static_assert(distance(seqno{65530}, seqno{4}) == 10, "");
+static_assert(seqno{65530} < seqno{4}, "");
+static_assert(!(seqno{4} < seqno{65530}), "");
+static_assert(seqno{4} > seqno{65530}, "");
+static_assert(seqno{4} >= seqno{4} && seqno{4} <= seqno{4}, "");
+static_assert(seqno{0} < seqno{32768} && !(seqno{32768} < seqno{0}), "");
+static_assert(!strong::type_is<seqno, strong::ordered>{}, "");
+static_assert(!is_detected<add, seqno, seqno>{}, "");
+
+TEST_CASE("serial_number finds gaps across the wrap around")
+{
+  seqno s{65534};
+  s += 3;
+  REQUIRE(s == seqno{1});
+  s -= 2;
+  REQUIRE(s == seqno{65535});
+
+  std::vector<seqno> v;
+  for (unsigned i = 0; i != 300; ++i) v.push_back(seqno{65400} + static_cast<int16_t>(i));
+  REQUIRE(strong::find_gap(v.data(), v.data() + v.size()) == v.data() + v.size());
+  REQUIRE(strong::count_missing(v.data(), v.data() + v.size()) == 0U);
+
+  v[200] += 3;
+  v[201] += 3;
+  REQUIRE(value_of(v[199]) == 63);
+  REQUIRE(strong::find_gap(v.data(), v.data() + v.size()) == v.data() + 199);
+  REQUIRE(strong::count_missing(v.data(), v.data() + v.size()) == 3U);
+
+  v[250] = v[249];
+  REQUIRE(strong::count_missing(v.data(), v.data() + v.size()) == 4U);
+  REQUIRE(strong::find_gap(v.data(), v.data()) == v.data());
+}
+
+namespace {
+using digit = strong::type<int, struct digit_, strong::bounded<0, 9>, strong::equality>;
+using number = strong::type<int, struct digit_, strong::bounded<0, 99>, strong::equality>;
+using udigit = strong::type<unsigned, struct udigit_, strong::bounded<0, 9>>;
+using dozen = strong::type<std::array<int, 12>, struct dozen_, strong::indexed<digit>>;
+using short_list = strong::type<std::array<int, 5>, struct short_list_, strong::indexed<digit>>;
+using any_dozen = strong::type<std::array<int, 12>, struct any_dozen_, strong::indexed<>>;
+}
+
+static_assert(std::is_same<decltype(digit{3} + digit{7}),
+                           strong::type<int, digit_, strong::bounded<0, 18>, strong::equality>>{}, "");
+static_assert(decltype(digit{3} - digit{7})::lower_bound::value == -9, "");
+static_assert(decltype(digit{3} - number{7})::upper_bound::value == 9, "");
+static_assert(decltype(digit{3} * digit{7})::upper_bound::value == 81, "");
+static_assert(value_of(digit{3} * digit{7}) == 21, "");
+static_assert(std::is_convertible<digit, number>{}, "");
+static_assert(std::is_convertible<decltype(digit{0} * digit{0}), number>{}, "");
+static_assert(!std::is_convertible<number, digit>{}, "");
+static_assert(!is_detected<add, digit, udigit>{}, "");
+static_assert(strong::bounded_cast<digit>(digit{9} - digit{2}) == digit{7}, "");
+static_assert(noexcept(std::declval<dozen&>().at(std::declval<const digit&>())) == !STRONG_CHECKED, "");
+static_assert(noexcept(std::declval<any_dozen&>().at(std::declval<const digit&>())) == !STRONG_CHECKED, "");
+static_assert(!noexcept(std::declval<any_dozen&>().at(std::declval<const int&>())), "");
+static_assert(!noexcept(std::declval<short_list&>().at(std::declval<const digit&>())), "");
+
+TEST_CASE("bounded values are checked at construction")
+{
+  number n = digit{3} * digit{7} + digit{9};
+  REQUIRE(n == number{30});
+  udigit u{9U};
+  REQUIRE(value_of(u) == 9U);
+#if STRONG_CHECKED
+  REQUIRE_THROWS_AS(digit{10}, std::out_of_range);
+  REQUIRE_THROWS_AS(digit{-1}, std::out_of_range);
+  REQUIRE_THROWS_AS(strong::bounded_cast<digit>(digit{9} + digit{1}), std::out_of_range);
+#endif
+
+  dozen d{std::array<int, 12>{}};
+  d.at(digit{9}) = 3;
+  REQUIRE(d[digit{9}] == 3);
+  short_list s{std::array<int, 5>{}};
+  REQUIRE_THROWS_AS(s.at(digit{5}), std::out_of_range);
+#if STRONG_CHECKED
+  digit broken{9};
+  value_of(broken) = 12;
+  REQUIRE_THROWS_AS(d.at(broken), std::out_of_range);
+  const any_dozen a{std::array<int, 12>{}};
+  REQUIRE_THROWS_AS(a.at(broken), std::out_of_range);
+#endif
+}
+
+namespace {
+using compact_id = strong::type<strong::compact<uint32_t>, struct compact_id_,
+                                strong::regular, strong::ordered, strong::hashable, strong::arithmetic>;
+using small_offset = strong::type<strong::compact<int16_t>, struct small_offset_, strong::equality>;
+}
+
+static_assert(sizeof(compact_id) == sizeof(uint32_t), "");
+static_assert(sizeof(small_offset) == sizeof(int16_t), "");
+static_assert(std::is_trivially_copyable<compact_id>{}, "");
+static_assert(std::is_same<decltype(value_of(std::declval<const compact_id&>()).load()), uint64_t>{}, "");
+static_assert(value_of(small_offset{-3}).load() == -3, "");
+static_assert(noexcept(std::declval<compact_id&>() += std::declval<const compact_id&>()) == !STRONG_CHECKED, "");
+
+TEST_CASE("compact stores narrow and computes wide")
+{
+  std::vector<compact_id> ids;
+  for (uint32_t i = 0; i != 4; ++i) ids.emplace_back(uint64_t{i} * 1000000000U);
+  REQUIRE(ids[3] > ids[2]);
+  REQUIRE(ids[1] + ids[2] == compact_id{3000000000U});
+  const uint64_t wide = value_of(ids[3]) * 2U;
+  REQUIRE(wide == 6000000000U);
+  REQUIRE(std::hash<compact_id>{}(ids[1]) == std::hash<uint64_t>{}(1000000000U));
+  small_offset o{-32768};
+  REQUIRE(value_of(o) == -32768);
+#if STRONG_CHECKED
+  REQUIRE_THROWS_AS(compact_id{uint64_t{1} << 32}, std::out_of_range);
+  REQUIRE_THROWS_AS(ids[3] + ids[2], std::out_of_range);
+  REQUIRE_THROWS_AS(small_offset{32768}, std::out_of_range);
+#endif
+}
+
+namespace {
+using price = strong::fixed_point<int64_t, strong::decimal<4>, struct price_>;
+using q16 = strong::fixed_point<int32_t, strong::fraction_bits<16>, struct q16_>;
+using cents = strong::fixed_point<int32_t, strong::decimal<2>, struct cents_, strong::round_toward_zero>;
+using whole = strong::fixed_point<int32_t, strong::decimal<0>, struct whole_>;
+using hundredths = strong::fixed_point<int32_t, strong::decimal<2>, struct hundredths_>;
+
+constexpr price tick = price::from_literal("0.0025");
+}
+
+static_assert(value_of(tick) == 25, "");
+static_assert(value_of(price::from_literal("-12.5")) == -125000, "");
+static_assert(price::from_literal("1.5") * price::from_literal("2.25") == price::from_literal("3.375"), "");
+static_assert(price::from_literal("1") / price::from_literal("3") == price::from_literal("0.3333"), "");
+static_assert(price::from_literal("2") / price::from_literal("3") == price::from_literal("0.6667"), "");
+static_assert(cents::from_literal("2") / cents::from_literal("3") == cents::from_literal("0.66"), "");
+static_assert(price::from_integer(3) * 2 == price::from_literal("6"), "");
+static_assert(value_of(q16::from_literal("1.5")) == 0x18000, "");
+static_assert(value_of(whole::from_literal("3.5")) == 4, "");
+static_assert(value_of(whole::from_literal("2.5")) == 2, "");
+static_assert(value_of(whole::from_literal("-1.5")) == -2, "");
+static_assert(value_of(whole::from_literal("-0.5")) == 0, "");
+static_assert(value_of(hundredths::from_literal("0.125")) == 12, "");
+static_assert(value_of(hundredths::from_literal("0.125000000001")) == 13, "");
+static_assert(value_of(hundredths::from_literal("0.13499999999999")) == 13, "");
+static_assert(value_of(cents::from_literal("-0.129999999999")) == -12, "");
+static_assert(value_of(q16::from_literal("0.0000076293945312500000001")) == 1, "");
+static_assert(q16::from_double(0.25) * q16::from_integer(4) == q16::from_integer(1), "");
+static_assert(strong::type_is<price, strong::ordered>{}, "");
+static_assert(is_hashable<price>{}, "");
+static_assert(!is_detected<add, price, q16>{}, "");
+static_assert(sizeof(price) == sizeof(int64_t), "");
+
+TEST_CASE("fixed_point rounds rescaled products and quotients")
+{
+  REQUIRE(strong::round_half_even::divide(5, 2) == 2);
+  REQUIRE(strong::round_half_even::divide(7, 2) == 4);
+  REQUIRE(strong::round_half_even::divide(-5, 2) == -2);
+  REQUIRE(strong::round_half_away_from_zero::divide(-5, 2) == -3);
+  REQUIRE(strong::round_down::divide(-5, 2) == -3);
+  REQUIRE(strong::round_up::divide(5, 2) == 3);
+  REQUIRE(strong::round_up::divide(-5, 2) == -2);
+
+  const auto a = price::from_literal("0.0001");
+  const auto half = price::from_literal("0.5");
+  REQUIRE(a * half == price::from_literal("0"));
+  REQUIRE(strong::fixed_multiply<strong::round_up>(a, half) == a);
+  REQUIRE(strong::fixed_divide<strong::round_down>(price::from_literal("-1"), price::from_integer(3))
+          == price::from_literal("-0.3334"));
+  REQUIRE(price::from_literal("123.45").to_double() == 123.45);
+  REQUIRE(price::from_literal("10") / 4 == price::from_literal("2.5"));
+  REQUIRE(-tick + tick == price::from_integer(0));
+  REQUIRE(tick < price::from_literal("0.003"));
+  REQUIRE_THROWS_AS(price::from_literal("1.2x"), std::invalid_argument);
+  REQUIRE_THROWS_AS(cents::from_literal("30000000"), std::out_of_range);
+}
+
+#if STRONG_HAS_CHARCONV
+TEST_CASE("fixed_point formats and parses with charconv")
+{
+  char buf[32];
+  auto r = to_chars(buf, buf + sizeof(buf), price::from_literal("-12.5"));
+  REQUIRE(std::string(buf, r.ptr) == "-12.5000");
+  r = to_chars(buf, buf + sizeof(buf), q16::from_literal("-3.0625"));
+  REQUIRE(std::string(buf, r.ptr) == "-3.0625");
+  r = to_chars(buf, buf + sizeof(buf), q16::from_integer(7));
+  REQUIRE(std::string(buf, r.ptr) == "7");
+  REQUIRE(to_chars(buf, buf + 4, price::from_literal("1.5")).ec == std::errc::value_too_large);
+
+  const std::string text = "42.125,x";
+  price p = price::from_integer(0);
+  auto f = from_chars(text.data(), text.data() + text.size(), p);
+  REQUIRE(f.ec == std::errc{});
+  REQUIRE(*f.ptr == ',');
+  REQUIRE(p == price::from_literal("42.125"));
+  f = from_chars(f.ptr + 1, text.data() + text.size(), p);
+  REQUIRE(f.ec == std::errc::invalid_argument);
+  const std::string big = "99999999999999999999";
+  REQUIRE(from_chars(big.data(), big.data() + big.size(), p).ec == std::errc::result_out_of_range);
+}
+#endif
+
+namespace {
+using symbol = strong::interned<struct symbol_, strong::ostreamable>;
+}
+
+static_assert(sizeof(symbol) == sizeof(void*), "");
+static_assert(std::is_trivially_copyable<symbol>{}, "");
+static_assert(is_hashable<symbol>{}, "");
+
+TEST_CASE("interned strings are shared between threads and have dense codes")
+{
+  REQUIRE(value_of(symbol{}).empty());
+  REQUIRE(symbol{""} == symbol{});
+  REQUIRE(value_of(symbol{}).code() == 0U);
+
+  constexpr int threads = 4;
+  constexpr int count = 600;
+  std::vector<symbol> syms(threads * count);
+  std::vector<std::thread> workers;
+  for (int t = 0; t != threads; ++t)
+  {
+    workers.emplace_back([&syms, t] {
+      for (int i = 0; i != count; ++i) syms[t * count + i] = symbol{std::to_string(i)};
+    });
+  }
+  for (auto& w : workers) w.join();
+  bool same = true;
+  for (int i = 0; i != threads * count; ++i) same = same && syms[i] == syms[i % count];
+  REQUIRE(same);
+  REQUIRE(strong::interned_string<symbol_>::code_count() == count + 1U);
+  REQUIRE(value_of(syms[42]).str() == "42");
+  REQUIRE(std::strcmp(value_of(syms[7]).c_str(), "7") == 0);
+
+  std::vector<uint32_t> codes(count);
+  strong::encode_interned(syms.data(), count, codes.data());
+  std::sort(codes.begin(), codes.end());
+  REQUIRE(codes.front() == 1U);
+  REQUIRE(std::adjacent_find(codes.begin(), codes.end(),
+                             [](uint32_t a, uint32_t b) { return b != a + 1; }) == codes.end());
+  strong::encode_interned(syms.data(), count, codes.data());
+  std::vector<symbol> decoded(count);
+  strong::decode_interned(codes.data(), count, decoded.data());
+  REQUIRE(decoded == std::vector<symbol>(syms.begin(), syms.begin() + count));
+
+  std::ostringstream os;
+  os << syms[123];
+  REQUIRE(os.str() == "123");
+}
+
+TEST_CASE("every code below code_count() decodes while strings are interned")
+{
+  using word = strong::interned_string<struct word_>;
+  REQUIRE(word::from_code(1).empty());
+  constexpr int count = 2000;
+  std::atomic<bool> done{false};
+  std::thread writer([&done] {
+    for (int i = 0; i != count; ++i) (void)word{std::to_string(i)};
+    done = true;
+  });
+  bool all_found = true;
+  bool finished = false;
+  while (!finished)
+  {
+    finished = done;
+    const auto n = word::code_count();
+    for (std::uint32_t c = 1; c != n; ++c) all_found = all_found && !word::from_code(c).empty();
+  }
+  writer.join();
+  REQUIRE(all_found);
+  REQUIRE(word::code_count() == count + 1U);
+  REQUIRE(word::from_code(count).str() == std::to_string(count - 1));
+}
+
+namespace {
+using ticker = strong::fixed_string<15, struct ticker_, strong::ostreamable>;
+using venue = strong::fixed_string<4, struct venue_>;
+
+constexpr ticker aapl{"AAPL"};
+}
+
+static_assert(sizeof(ticker) == 16, "");
+static_assert(sizeof(venue) == 8, "");
+static_assert(std::is_trivially_copyable<ticker>{}, "");
+static_assert(value_of(aapl).size() == 4, "");
+static_assert(value_of(aapl)[3] == 'L', "");
+static_assert(value_of(ticker{"ABCDEFGHIJKLMNO"}).size() == 15, "");
+static_assert(value_of(ticker{}).empty(), "");
+static_assert(!std::is_constructible<ticker, venue>{}, "");
+static_assert(is_hashable<ticker>{}, "");
+
+TEST_CASE("fixed_string compares like std::string")
+{
+  const std::vector<std::string> texts{ "", "A", "AA", "AAPL", "AAPL.O", "ABCDEFGHIJKLMNO",
+                                        "ABCDEFGHIJKLMNN", "ABCDEFGHZ", "\xe9", "z" };
+  bool consistent = true;
+  for (auto& a : texts)
+  {
+    for (auto& b : texts)
+    {
+      const ticker ta{a};
+      const ticker tb{b};
+      consistent = consistent
+                   && (ta == tb) == (a == b)
+                   && (ta < tb) == (a < b)
+                   && (ta >= tb) == (a >= b)
+                   && (std::hash<ticker>{}(ta) == std::hash<ticker>{}(tb) || a != b);
+    }
+  }
+  REQUIRE(consistent);
+  REQUIRE(value_of(ticker{std::string("MSFT")}).str() == "MSFT");
+  REQUIRE_THROWS_AS(venue{std::string("XNASD")}, std::length_error);
+  REQUIRE_THROWS_AS(venue{std::string("a\0b", 3)}, std::invalid_argument);
+  REQUIRE(venue{"a\0b"} == venue{"a"});
+
+  std::ostringstream os;
+  os << aapl;
+  REQUIRE(os.str() == "AAPL");
+}
+
+namespace {
+using names = strong::type<std::vector<std::string>, struct names_, strong::equality>;
+}
+
+static_assert(std::uses_allocator<names, std::allocator<std::string>>{}, "");
+static_assert(!std::uses_allocator<strong::type<int, struct int_>, std::allocator<int>>{}, "");
+static_assert(std::is_constructible<names, std::allocator_arg_t, const std::allocator<std::string>&, std::size_t>{}, "");
+static_assert(!std::is_constructible<strong::type<int, struct int_>, std::allocator_arg_t, const std::allocator<int>&, int>{}, "");
+
+template <typename S, typename ... A>
+using copy_list_initializable = decltype(std::declval<void (&)(S)>()({std::declval<A>()...}));
+
+static_assert(is_detected<copy_list_initializable, names, const names&>{}, "");
+static_assert(!is_detected<copy_list_initializable, names, std::allocator_arg_t, const std::allocator<std::string>&, const names&>{}, "");
+static_assert(!is_detected<copy_list_initializable, names, std::allocator_arg_t, const std::allocator<std::string>&, std::size_t>{}, "");
+
+TEST_CASE("allocator extended construction passes the allocator to the underlying value")
+{
+  const std::allocator<std::string> alloc;
+  const names n{std::allocator_arg, alloc, 3U, std::string("x")};
+  REQUIRE(value_of(n).size() == 3U);
+  const names copy{std::allocator_arg, alloc, n};
+  REQUIRE(copy == n);
+}
+
+#if __cplusplus >= 201703L && __has_include(<memory_resource>)
+#include <memory_resource>
+
+namespace {
+using pmr_name = strong::type<std::pmr::string, struct pmr_name_, strong::equality>;
+}
+
+static_assert(std::uses_allocator_v<pmr_name, std::pmr::polymorphic_allocator<pmr_name>>);
+
+TEST_CASE("strong types of allocator aware types allocate from the arena of a pmr container")
+{
+  alignas(std::max_align_t) char buffer[16 * 1024];
+  std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+  std::pmr::vector<pmr_name> v(&arena);
+  v.emplace_back("a name much too long for the small string optimization");
+  v.push_back(v.front());
+  for (int i = 0; i != 20; ++i) v.emplace_back(std::string(40, char('a' + i)));
+  const bool all_in_arena = std::all_of(v.begin(), v.end(), [&](const pmr_name& n) {
+    return value_of(n).get_allocator().resource() == &arena;
+  });
+  REQUIRE(all_in_arena);
+  REQUIRE(v[1] == v[0]);
+  REQUIRE(value_of(v.back()).find_first_not_of('t') == std::pmr::string::npos);
+}
+#endif
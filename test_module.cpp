@@ -0,0 +1,38 @@
+/*
+ * strong_type C++14/17/20 strong typedef library
+ *
+ * Copyright (C) Björn Fahller
+ *
+ *  Use, modification and distribution is subject to the
+ *  Boost Software License, Version 1.0. (See accompanying
+ *  file LICENSE_1_0.txt or copy at
+ *  http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Project home: https://github.com/rollbear/strong_type
+ */
+
+// Smoke test of the strong_type module. Exits with 0 if the operations of
+// the modifiers are reachable through import.
+
+#include <functional>
+
+import strong_type;
+
+using meters = strong::type<int, struct meters_, strong::regular, strong::ordered,
+                            strong::arithmetic, strong::hashable>;
+
+static_assert(strong::type_is<meters, strong::regular>::value);
+
+int main()
+{
+  meters a{1};
+  meters b{2};
+  meters c{strong::uninitialized};
+  c = a;
+  const bool ok = a + b == meters{3}
+                  && a < b
+                  && value_of(b) == 2
+                  && c == a
+                  && std::hash<meters>{}(a) == std::hash<int>{}(1);
+  return ok ? 0 : 1;
+}